@@ -0,0 +1,208 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "avl_tree.h"
+
+// Memória e latência da AVLTree<int> com 1M chaves aleatórias: bytes pedidos
+// ao alocador por chave durante a carga, tempo por insert e por contains e o
+// tempo de destruir a árvore. Conta as alocações substituindo o operator new
+// global; o cabeçalho de cada alocação (8 bytes na glibc) não é contado.
+// A AVLTree guarda os nodos em uma NodeArena; PointerTree é a mesma árvore
+// com um nodo alocado por chave e filhos por ponteiro, como antes da arena,
+// para que as duas linhas venham do mesmo binário.
+
+namespace {
+std::size_t allocated = 0;
+
+const std::size_t SIZE = 1000000u;
+const unsigned SEED = 42u;
+
+//! Devolve memória ao malloc fora de linha: expandido junto de um new, o
+//! std::free acusaria -Wmismatched-new-delete.
+__attribute__((noinline)) void release(void* pointer) { std::free(pointer); }
+
+//! AVL com nodos por ponteiro: inserção, busca e destruição da AVLTree
+class PointerTree {
+ public:
+  PointerTree(void) = default;
+  PointerTree(const PointerTree&) = delete;
+  PointerTree& operator=(const PointerTree&) = delete;
+
+  ~PointerTree(void) {
+    Node* node = root_;
+    while (node != nullptr) {
+      if (node->left != nullptr) {
+        Node* left = node->left;
+        node->left = left->right;
+        left->right = node;
+        node = left;
+      } else {
+        Node* right = node->right;
+        delete node;
+        node = right;
+      }
+    }
+  }
+
+  void insert(int data) {
+    Node** path[MAX_HEIGHT];
+    std::size_t depth = 0u;
+    Node** link = &root_;
+    while (*link != nullptr) {
+      path[depth++] = link;
+      link = data < (*link)->data ? &(*link)->left : &(*link)->right;
+    }
+    *link = new Node{data};
+    while (depth != 0u) {
+      link = path[--depth];
+      int height = (*link)->height;
+      *link = rebalance(*link);
+      if ((*link)->height == height) break;
+    }
+  }
+
+  bool contains(int data) const {
+    const Node* node = root_;
+    while (node != nullptr) {
+      if (data < node->data) {
+        node = node->left;
+      } else if (data > node->data) {
+        node = node->right;
+      } else {
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  struct Node {
+    int data;
+    int height{0};
+    Node* left{nullptr};
+    Node* right{nullptr};
+  };
+
+  static constexpr std::size_t MAX_HEIGHT = 96u;
+
+  static int height(const Node* node) {
+    return node == nullptr ? -1 : node->height;
+  }
+
+  static void update(Node* node) {
+    node->height = std::max(height(node->left), height(node->right)) + 1;
+  }
+
+  static int balance(const Node* node) {
+    return height(node->left) - height(node->right);
+  }
+
+  static Node* rotate_right(Node* node) {
+    Node* new_root = node->left;
+    node->left = new_root->right;
+    new_root->right = node;
+    update(node);
+    update(new_root);
+    return new_root;
+  }
+
+  static Node* rotate_left(Node* node) {
+    Node* new_root = node->right;
+    node->right = new_root->left;
+    new_root->left = node;
+    update(node);
+    update(new_root);
+    return new_root;
+  }
+
+  static Node* rebalance(Node* node) {
+    update(node);
+    int factor = balance(node);
+    if (factor > 1) {
+      if (balance(node->left) < 0) {
+        node->left = rotate_left(node->left);
+      }
+      return rotate_right(node);
+    }
+    if (factor < -1) {
+      if (balance(node->right) > 0) {
+        node->right = rotate_right(node->right);
+      }
+      return rotate_left(node);
+    }
+    return node;
+  }
+
+  Node* root_{nullptr};
+};
+
+template <typename F>
+double measure(F operation) {
+  auto start = std::chrono::steady_clock::now();
+  operation();
+  auto end = std::chrono::steady_clock::now();
+  std::chrono::duration<double, std::nano> elapsed = end - start;
+  return elapsed.count();
+}
+
+template <typename Tree>
+bool report(const char* name, const std::vector<int>& keys,
+            const std::vector<int>& lookups) {
+  auto* tree = new Tree;
+  std::size_t before = allocated;
+  double insert = measure([&] {
+    for (auto key : keys) {
+      tree->insert(key);
+    }
+  });
+  double bytes = static_cast<double>(allocated - before) / SIZE;
+
+  std::size_t found = 0;
+  double lookup = measure([&] {
+    for (auto key : lookups) {
+      found += tree->contains(key);
+    }
+  });
+
+  double teardown = measure([&] { delete tree; });
+
+  std::printf("%-10s %14.1f %14.1f %14.1f %14.2f\n", name, bytes,
+              insert / SIZE, lookup / SIZE, teardown / 1e6);
+  return found != 0;
+}
+}  // namespace
+
+void* operator new(std::size_t size) {
+  allocated += size;
+  void* pointer = std::malloc(size == 0 ? 1 : size);
+  if (pointer == nullptr) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+void operator delete(void* pointer) noexcept { release(pointer); }
+
+void operator delete(void* pointer, std::size_t) noexcept { release(pointer); }
+
+int main(void) {
+  std::vector<int> keys(SIZE);
+  std::vector<int> lookups(SIZE);
+  unsigned state = SEED;
+  for (std::size_t i = 0; i != SIZE; i++) {
+    // Gerador congruencial: as mesmas chaves em qualquer versão da árvore.
+    state = state * 1664525u + 1013904223u;
+    keys[i] = static_cast<int>(state >> 1);
+    lookups[i] = i % 2 ? keys[(i * 7919u) % SIZE] : static_cast<int>(i);
+  }
+
+  std::printf("%-10s %14s %14s %14s %14s\n", "nodes", "bytes/key",
+              "insert ns/op", "lookup ns/op", "teardown ms");
+  bool found = report<PointerTree>("pointers", keys, lookups);
+  found &= report<structures::AVLTree<int>>("arena", keys, lookups);
+  return !found;
+}
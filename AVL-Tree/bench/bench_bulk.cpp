@@ -0,0 +1,66 @@
+#include <chrono>
+#include <cstdio>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "avl_tree.h"
+
+// Carga de árvores AVL de até 10M chaves ordenadas. Compara insert de cada
+// chave (busca a partir da raiz e rebalanceamento) com from_sorted, que liga
+// os nodos de uma só vez em O(n), e merge de duas metades intercaladas, que
+// religa os nodos existentes sem alocar.
+
+namespace {
+const std::size_t SIZES[] = {100000u, 1000000u, 10000000u};
+
+template <typename F>
+double measure(F operation) {
+  auto start = std::chrono::steady_clock::now();
+  operation();
+  auto end = std::chrono::steady_clock::now();
+  std::chrono::duration<double, std::milli> elapsed = end - start;
+  return elapsed.count();
+}
+}  // namespace
+
+int main(void) {
+  std::printf("%-10s %14s %14s %14s\n", "size", "insert ms",
+              "from_sorted ms", "merge ms");
+  std::size_t total = 0;
+  for (auto size : SIZES) {
+    std::vector<int> values(size);
+    std::iota(values.begin(), values.end(), 0);
+
+    double insert = 0.0;
+    {
+      structures::AVLTree<int> inserted;
+      insert = measure([&] {
+        for (auto value : values) {
+          inserted.insert(value);
+        }
+      });
+      total += inserted.size();
+    }
+
+    structures::AVLTree<int> loaded;
+    double load = measure([&] {
+      loaded = structures::AVLTree<int>::from_sorted(values.begin(),
+                                                     values.end());
+    });
+
+    std::vector<int> evens, odds;
+    for (auto value : values) {
+      (value % 2 == 0 ? evens : odds).push_back(value);
+    }
+    auto merged =
+        structures::AVLTree<int>::from_sorted(evens.begin(), evens.end());
+    auto other =
+        structures::AVLTree<int>::from_sorted(odds.begin(), odds.end());
+    double merge = measure([&] { merged.merge(std::move(other)); });
+
+    std::printf("%-10zu %14.2f %14.2f %14.2f\n", size, insert, load, merge);
+    total += loaded.size() + merged.size();
+  }
+  return total == 0;
+}
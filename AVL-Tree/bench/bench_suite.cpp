@@ -0,0 +1,46 @@
+#include <vector>
+
+#include "avl_tree.h"
+#include "benchmark.h"
+
+// Suíte de desempenho da AVLTree (ver benchmark::Suite). Para cada tamanho:
+// insert (chaves em ordem aleatória), insert_sorted (chaves em ordem
+// crescente, o pior caso de uma árvore sem balanceamento), lookup (contains
+// de chaves aleatórias), traverse (percurso em-ordem completo pelo iterador) e
+// remove (chaves em outra ordem aleatória).
+
+int main(int argc, char* argv[]) {
+  benchmark::Suite suite{argc, argv};
+  for (auto size : suite.sizes()) {
+    {
+      structures::AVLTree<int> sorted;
+      suite.measure("AVLTree", "insert_sorted", size, size,
+                    [&](std::size_t i) { sorted.insert(static_cast<int>(i)); });
+    }
+
+    structures::AVLTree<int> tree;
+    std::vector<int> keys = benchmark::permutation(size);
+    suite.measure("AVLTree", "insert", size, size,
+                  [&](std::size_t i) { tree.insert(keys[i]); });
+
+    std::vector<int> lookups = benchmark::random_keys(size, size);
+    suite.measure("AVLTree", "lookup", size, size, [&](std::size_t i) {
+      benchmark::keep(tree.contains(lookups[i]));
+    });
+
+    suite.measure("AVLTree", "traverse", size,
+                  suite.operations(size, benchmark::LINEAR),
+                  [&](std::size_t) {
+                    long sum = 0;
+                    for (auto data : tree) {
+                      sum += data;
+                    }
+                    benchmark::keep(sum);
+                  });
+
+    std::vector<int> removals = benchmark::permutation(size, 7u);
+    suite.measure("AVLTree", "remove", size, size,
+                  [&](std::size_t i) { tree.remove(removals[i]); });
+  }
+  return 0;
+}
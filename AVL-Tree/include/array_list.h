@@ -3,6 +3,7 @@
 
 #include <cstdint>
 #include <stdexcept>
+#include <utility>
 
 namespace structures {
 template <typename T>
@@ -13,6 +14,19 @@ template <typename T>
 */
 class ArrayList {
  public:
+  //! Tipo do elemento
+  using value_type = T;
+
+  //! Iterador de acesso aleatório
+  /*!
+     Ponteiro para elemento. Percorre os elementos em ordem, sem verificação de
+     limites, e é aceito pelos algoritmos da biblioteca padrão.
+   */
+  using iterator = T*;
+
+  //! Iterador constante de acesso aleatório
+  using const_iterator = const T*;
+
   //! Construtor padrão
   /*!
      Cria uma lista utilizando o atributo de tamanho padrão (DEFAULT_MAX_SIZE)
@@ -28,12 +42,42 @@ class ArrayList {
   */
   explicit ArrayList(std::size_t max_size);
 
+  //! Construtor com parâmetros de tamanho máximo e crescimento
+  /*!
+     Cria uma lista utilizando o parâmetro max_size como capacidade inicial. Se
+     growable for verdadeiro, inserir em uma lista cheia dobra a capacidade em
+     vez de lançar exceção (out_of_range).
+
+     \param max_size: Capacidade inicial da lista (size_t).
+     \param growable: Habilita o crescimento automático (bool).
+  */
+  ArrayList(std::size_t max_size, bool growable);
+
+  //! Construtor de movimento
+  /*!
+     Cria uma lista tomando para si o vetor de other, sem copiar os elementos.
+     other fica vazia e com capacidade zero.
+
+     \param other: Lista de origem (ArrayList&&).
+  */
+  ArrayList(ArrayList&& other);
+
   //! Destrutor
   /*!
      Usado para destruir o objeto do tipo lista.
    */
   ~ArrayList(void);
 
+  //! Atribuição por movimento
+  /*!
+     Libera o vetor atual e toma para si o vetor de other, sem copiar os
+     elementos. other fica vazia e com capacidade zero.
+
+     \param other: Lista de origem (ArrayList&&).
+     \return Referência para esta lista (ArrayList&).
+  */
+  ArrayList& operator=(ArrayList&& other);
+
   //! Método limpa
   /*!
      Limpa a lista.
@@ -50,6 +94,29 @@ class ArrayList {
    */
   void push_back(const T& data);
 
+  //! Método adiciona no fim da lista (movimento)
+  /*!
+     Como push_back(const T&), mas move data para a lista em vez de copiá-lo.
+
+     \param data: Elemento a ser movido para a lista (T&&).
+   */
+  void push_back(T&& data);
+
+  //! Método constrói no fim da lista
+  /*!
+     Constrói um elemento com os argumentos args e o adiciona no fim da lista.
+     As posições do vetor já estão construídas, então o elemento é construído
+     uma vez e movido para a sua posição, sem cópias. Se não houver espaço,
+     lança exceção (out_of_range).
+
+     \param args: Argumentos repassados ao construtor de T.
+     \return Referência ao elemento adicionado (T&).
+   */
+  template <typename... Args>
+  T& emplace_back(Args&&... args) {
+    return emplace(size(), std::forward<Args>(args)...);
+  }
+
   //! Método adiciona no início da lista
   /*!
      Adiciona elemento (data) no início da lista, se houver espaço. Se não
@@ -60,6 +127,26 @@ class ArrayList {
    */
   void push_front(const T& data);
 
+  //! Método adiciona no início da lista (movimento)
+  /*!
+     Como push_front(const T&), mas move data para a lista em vez de copiá-lo.
+
+     \param data: Elemento a ser movido para a lista (T&&).
+   */
+  void push_front(T&& data);
+
+  //! Método constrói no início da lista
+  /*!
+     Como emplace_back, mas adiciona o elemento no início da lista.
+
+     \param args: Argumentos repassados ao construtor de T.
+     \return Referência ao elemento adicionado (T&).
+   */
+  template <typename... Args>
+  T& emplace_front(Args&&... args) {
+    return emplace(0u, std::forward<Args>(args)...);
+  }
+
   //! Método insere na posição
   /*!
      Insere elemento (data) em uma dada posição da lista (index), se houver
@@ -71,10 +158,39 @@ class ArrayList {
    */
   void insert(const T& data, std::size_t index);
 
+  //! Método insere na posição (movimento)
+  /*!
+     Como insert(const T&, size_t), mas move data para a lista em vez de
+     copiá-lo.
+
+     \param data: Elemento a ser movido para a lista (T&&).
+     \param index: Posição para inserir o elemento (size_t).
+   */
+  void insert(T&& data, std::size_t index);
+
+  //! Método constrói na posição
+  /*!
+     Como emplace_back, mas insere o elemento na posição index. Se a posição
+     não for válida, lança exceção (out_of_range).
+
+     \param index: Posição para inserir o elemento (size_t).
+     \param args: Argumentos repassados ao construtor de T.
+     \return Referência ao elemento inserido (T&).
+   */
+  template <typename... Args>
+  T& emplace(std::size_t index, Args&&... args) {
+    // Constrói antes de abrir a posição: args pode referenciar um elemento
+    // da própria lista, que open desloca ou libera ao realocar.
+    T data(std::forward<Args>(args)...);
+    return open(index) = std::move(data);
+  }
+
   //! Método insere ordenado
   /*!
-     Insere elemento (data) em ordem na lista (caso a lista possua ordem). Se
-     não houver mais espaço na lista, lança exceção (out_of_range).
+     Insere elemento (data) em ordem na lista (caso a lista possua ordem),
+     antes dos elementos iguais a ele. A posição é achada por busca binária
+     (lower_bound). Se não houver mais espaço na lista, lança exceção
+     (out_of_range).
 
      \param data: Referência constante para o elemento a ser inserido (const
      T&).
@@ -86,7 +202,7 @@ class ArrayList {
      Remove elemento no final da lista, se houver elementos. Se não houver
      elementos, lança exceção (out_of_range).
 
-     \return Elemento removido (T).
+     \return Elemento removido, movido para fora da lista (T).
    */
   T pop_back(void);
 
@@ -96,7 +212,7 @@ class ArrayList {
      para frente", se houver elementos. Se não houver elementos, lança exceção
      (out_of_range).
 
-     \return Elemento removido (T)
+     \return Elemento removido, movido para fora da lista (T).
    */
   T pop_front(void);
 
@@ -107,7 +223,7 @@ class ArrayList {
      exceção (out_of_range).
 
      \param index: Posição do elemento a ser removido (size_t).
-     \return Elemento removido (T)
+     \return Elemento removido, movido para fora da lista (T).
    */
   T pop(std::size_t index);
 
@@ -155,7 +271,8 @@ class ArrayList {
   //! Método achar
   /*!
      Acha a posição do elemento (data). Retorna o índice do elemento. Se o
-     elemento não estiver presente, retorna o tamanho da lista.
+     elemento não estiver presente, retorna o tamanho da lista. Para tipos
+     aritméticos a busca usa instruções SIMD (ver linear_find).
 
      \param data: Referência constante ao elemento (const T&).
      \return Posição do elemento, ou tamanho da lista, caso o elemento não está
@@ -163,6 +280,41 @@ class ArrayList {
    */
   std::size_t find(const T& data) const;
 
+  //! Método limite inferior
+  /*!
+     Busca binária pela primeira posição cujo elemento não é menor que data.
+     Requer que a lista esteja ordenada. Se todos os elementos forem menores,
+     retorna o tamanho da lista.
+
+     \param data: Referência constante ao elemento (const T&).
+     \return Posição do primeiro elemento não menor que data (size_t).
+   */
+  std::size_t lower_bound(const T& data) const;
+
+  //! Método limite superior
+  /*!
+     Busca binária pela primeira posição cujo elemento é maior que data.
+     Requer que a lista esteja ordenada. Se nenhum elemento for maior, retorna
+     o tamanho da lista.
+
+     \param data: Referência constante ao elemento (const T&).
+     \return Posição do primeiro elemento maior que data (size_t).
+   */
+  std::size_t upper_bound(const T& data) const;
+
+  //! Método achar ordenado
+  /*!
+     Acha a posição do elemento (data) por busca binária, em O(log n). Requer
+     que a lista esteja ordenada. Se o elemento não estiver presente, retorna
+     o tamanho da lista. Se a lista estiver vazia, lança exceção
+     (out_of_range).
+
+     \param data: Referência constante ao elemento (const T&).
+     \return Posição da primeira ocorrência do elemento, ou tamanho da lista,
+     caso o elemento não está presente (size_t).
+   */
+  std::size_t find_sorted(const T& data) const;
+
   //! Método tamanho
   /*!
      Getter do atributo size_, retorna o tamanho atual da lista.
@@ -179,6 +331,32 @@ class ArrayList {
    */
   std::size_t max_size(void) const;
 
+  //! Método expansível
+  /*!
+     Getter do atributo growable_. Retorna verdadeiro se a lista cresce
+     automaticamente ao inserir quando cheia.
+
+     \return true: Lista expansível (bool).
+     \return false: Lista de tamanho fixo (bool).
+   */
+  bool growable(void) const;
+
+  //! Método reserva
+  /*!
+     Garante que a capacidade da lista seja de pelo menos max_size elementos,
+     realocando o conteúdo se necessário. Nunca reduz a capacidade.
+
+     \param max_size: Capacidade mínima desejada (size_t).
+   */
+  void reserve(std::size_t max_size);
+
+  //! Método ajusta capacidade
+  /*!
+     Reduz a capacidade da lista para o seu tamanho atual, liberando a memória
+     excedente.
+   */
+  void shrink_to_fit(void);
+
   //! Método "em"
   /*!
      Retorna referência ao elemento na posição (index). Caso o índice seja
@@ -219,6 +397,75 @@ class ArrayList {
    */
   const T& operator[](std::size_t index) const;
 
+  //! Método dados
+  /*!
+     Retorna ponteiro para o primeiro elemento. Os size() elementos são
+     contíguos. O ponteiro é invalidado quando a lista é realocada (reserve,
+     shrink_to_fit ou crescimento automático).
+
+     \return Ponteiro para o primeiro elemento (T*).
+   */
+  T* data(void);
+
+  //! Método dados
+  /*!
+     Retorna ponteiro constante para o primeiro elemento.
+
+     \return Ponteiro constante para o primeiro elemento (const T*).
+   */
+  const T* data(void) const;
+
+  //! Método início
+  /*!
+     Retorna iterador para o primeiro elemento. Junto de end() permite o uso
+     de "range-for" e dos algoritmos da biblioteca padrão.
+
+     \return Iterador para o primeiro elemento (iterator).
+   */
+  iterator begin(void);
+
+  //! Método fim
+  /*!
+     Retorna iterador para a posição após o último elemento.
+
+     \return Iterador para a posição após o último elemento (iterator).
+   */
+  iterator end(void);
+
+  //! Método início
+  /*!
+     Retorna iterador constante para o primeiro elemento.
+
+     \return Iterador constante para o primeiro elemento (const_iterator).
+   */
+  const_iterator begin(void) const;
+
+  //! Método fim
+  /*!
+     Retorna iterador constante para a posição após o último elemento.
+
+     \return Iterador constante para a posição após o último elemento
+     (const_iterator).
+   */
+  const_iterator end(void) const;
+
+  //! Método início constante
+  /*!
+     Retorna iterador constante para o primeiro elemento.
+
+     \return Iterador constante para o primeiro elemento (const_iterator).
+   */
+  const_iterator cbegin(void) const;
+
+  //! Método fim constante
+  /*!
+     Retorna iterador constante para a posição após o último elemento.
+
+     \return Iterador constante para a posição após o último elemento
+     (const_iterator).
+   */
+  const_iterator cend(void) const;
+
  private:
   //! Conteúdo
   /*!
@@ -238,6 +485,12 @@ class ArrayList {
    */
   std::size_t max_size_;
 
+  //! Expansível
+  /*!
+     Indica se a lista cresce automaticamente quando cheia.
+   */
+  bool growable_;
+
   //! Tamanho máximo padrão
   /*!
      Capacidade máxima padrão da lista, utilizada pelo construtor sem parâmetros.
@@ -246,7 +499,8 @@ class ArrayList {
 
   //! Método privado mover para frente
   /*!
-     Move os elementos da lista "para frente". Copia elemento em [i + 1] para posição [i].
+     Move os elementos da lista "para frente". Move elemento em [i + 1] para
+     posição [i], em bloco (ver relocate_overlapping).
 
      \param index: indíce para iniciar a movimentação dos dados (size_t).
    */
@@ -254,11 +508,45 @@ class ArrayList {
 
   //! Método privado mover para trás
   /*!
-     Move os elementos da lista "para trás". Copia elemento em [i] para posição [i + 1].
+     Move os elementos da lista "para trás". Move elemento em [i] para posição
+     [i + 1], em bloco (ver relocate_overlapping).
 
      \param index: indíce para iniciar a movimentação dos dados (size_t).
    */
   void move_backward(std::size_t index);
+
+  //! Método privado abre posição
+  /*!
+     Confere a posição, garante espaço (make_room), move os elementos a partir
+     de index "para trás" e incrementa o tamanho. Se a posição não for válida
+     ou não houver espaço, lança exceção (out_of_range) sem alterar a lista
+     nem realocá-la.
+
+     \param index: Posição a ser aberta (size_t).
+     \return Referência à posição aberta, que deve receber o novo elemento
+     (T&).
+   */
+  T& open(std::size_t index);
+
+  //! Método privado garante espaço
+  /*!
+     Se a lista estiver cheia e for expansível, dobra sua capacidade. Retorna
+     verdadeiro se houver espaço para mais um elemento.
+
+     \return true: Há espaço para inserir (bool).
+     \return false: Lista cheia e de tamanho fixo (bool).
+   */
+  bool make_room(void);
+
+  //! Método privado realoca
+  /*!
+     Aloca um novo vetor com capacidade max_size e move os elementos atuais
+     para ele.
+
+     \param max_size: Nova capacidade da lista, não menor que o tamanho atual
+     (size_t).
+   */
+  void reallocate(std::size_t max_size);
 };
 }  // namespace structures
 
@@ -2,8 +2,15 @@
 #define STRUCTURES_AVL_TREE_H
 
 #include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "array_list.h"
+#include "node_arena.h"
 
 namespace structures {
 
@@ -56,16 +63,109 @@ template <typename T>
 //! Árvore AVL
 /*!
    Implementação da árvore binária semibalanceada AVL utilizando class
-   templates.
+   templates. Os nodos vivem em uma NodeArena da árvore e se ligam por índices
+   de 32 bits.
  */
 class AVLTree {
+ private:
+  struct Node;
+  using Index = typename NodeArena<Node>::Index;
+  static constexpr Index NIL = NodeArena<Node>::NIL;
+
  public:
+  //! Iterador Em-ordem
+  /*!
+     Iterador constante que percorre a árvore em-ordem sob demanda, sem
+     materializar uma lista. Guarda apenas os ancestrais do nodo atual que
+     ainda não foram visitados, no máximo height() + 1 índices.
+   */
+  class const_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    const_iterator(void) = default;
+
+    reference operator*(void) const { return (*arena_)[path_.back()].data_; }
+
+    pointer operator->(void) const { return &(*arena_)[path_.back()].data_; }
+
+    const_iterator& operator++(void) {
+      Index node = (*arena_)[path_.back()].right_child;
+      path_.pop_back();
+      descend(node);
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator previous = *this;
+      ++*this;
+      return previous;
+    }
+
+    bool operator==(const const_iterator& other) const {
+      if (path_.empty() || other.path_.empty()) {
+        return path_.empty() == other.path_.empty();
+      }
+      return path_.back() == other.path_.back();
+    }
+
+    bool operator!=(const const_iterator& other) const {
+      return !(*this == other);
+    }
+
+   private:
+    friend class AVLTree;
+
+    const_iterator(const NodeArena<Node>& arena, Index root) : arena_{&arena} {
+      descend(root);
+    }
+
+    //! Desce pela esquerda a partir de node, empilhando o caminho.
+    void descend(Index node) {
+      for (; node != NIL; node = (*arena_)[node].left_child) {
+        path_.push_back(node);
+      }
+    }
+
+    const NodeArena<Node>* arena_{nullptr};
+    std::vector<Index> path_;
+  };
+
+  //! Construtor
+  /*!
+     Cria uma árvore AVL vazia.
+   */
+  AVLTree(void) = default;
+
+  //! Construtor de Movimento
+  /*!
+     Cria uma árvore AVL tomando para si os nodos de other, sem copiar os
+     dados. other fica vazia.
+
+     \param other: Árvore de origem (AVLTree&&).
+   */
+  AVLTree(AVLTree&& other);
+
   //! Destrutor
   /*!
      Destrutor do objeto AVLTree.
    */
   ~AVLTree(void);
 
+  //! Atribuição por Movimento
+  /*!
+     Libera os nodos atuais e toma para si os nodos de other, sem copiar os
+     dados. other fica vazia.
+
+     \param other: Árvore de origem (AVLTree&&).
+     \return Referência para esta árvore (AVLTree&).
+   */
+  AVLTree& operator=(AVLTree&& other);
+
   //! Inserir Dado
   /*!
      Insere dado na árvore AVL.
@@ -75,9 +175,80 @@ class AVLTree {
    */
   void insert(const T& data);
 
+  //! Inserir Dado (movimento)
+  /*!
+     Como insert(const T&), mas move o dado para o novo nodo em vez de
+     copiá-lo.
+
+     \param data: Dado a ser movido para a árvore (T&&).
+   */
+  void insert(T&& data);
+
+  //! Construir Dado
+  /*!
+     Constrói o dado diretamente em um novo nodo, repassando args ao construtor
+     de T, e o insere na árvore AVL sem cópias nem movimentos.
+
+     \param args: Argumentos repassados ao construtor de T.
+   */
+  template <typename... Args>
+  void emplace(Args&&... args) {
+    insert_node(arena_.make(std::in_place, std::forward<Args>(args)...));
+  }
+
+  //! Construir de Sequência Ordenada
+  /*!
+     Cria uma árvore AVL perfeitamente balanceada com os elementos de
+     [first, last), que devem estar em ordem crescente. Custa O(n): os nodos
+     são alocados em sequência, encadeados pelos filhos da direita, e então
+     ligados de uma só vez, sem buscas nem rotações. Lança exceção
+     (invalid_argument) se a sequência não estiver ordenada.
+
+     \param first: Início da sequência (Iterator).
+     \param last: Fim da sequência (Iterator).
+     \return Árvore com os elementos (AVLTree).
+   */
+  template <typename Iterator>
+  static AVLTree from_sorted(Iterator first, Iterator last) {
+    // Durante a leitura, a sequência fica pendurada na raiz, e a árvore
+    // libera os nodos se uma exceção for lançada.
+    AVLTree tree;
+    Index* tail = &tree.root;
+    Index previous = NIL;
+    for (; first != last; ++first) {
+      Index node = tree.arena_.make(std::in_place, *first);
+      *tail = node;
+      tail = &tree.arena_[node].right_child;
+      ++tree.size_;
+      if (previous != NIL &&
+          tree.arena_[node].data_ < tree.arena_[previous].data_) {
+        throw std::invalid_argument("Sequence is not sorted");
+      }
+      previous = node;
+    }
+
+    Index vine = tree.root;
+    tree.root = tree.build(vine, tree.size_);
+    return tree;
+  }
+
+  //! Intercalar Árvores
+  /*!
+     Move todos os elementos de other para esta árvore, que fica perfeitamente
+     balanceada; other fica vazia. Custa O(n + m): os nodos das duas árvores
+     são desfeitos em sequências ordenadas, intercalados e religados, e os
+     dados de other são movidos para a arena desta árvore, reservada antes:
+     se a reserva lançar exceção, as duas árvores ficam como estavam. Se esta
+     árvore estiver vazia, apenas toma a arena de other.
+
+     \param other: Árvore de origem (AVLTree&&).
+   */
+  void merge(AVLTree&& other);
+
   //! Remover Dado
   /*!
-     Remove dado da árvore AVL.
+     Remove (se existir) dado da árvore AVL e rebalanceia apenas o caminho
+     de busca.
 
      \param data: Referência constante a tipo genérico (const T&), dado a ser
      removido.
@@ -112,16 +283,26 @@ class AVLTree {
 
   //! Altura
   /*!
-     Retorna altura da raíz.
+     Retorna altura da raíz, ou -1 se a árvore estiver vazia.
 
      \return altura: Altura da raíz.
    */
   int height(void) const;
 
+  //! Válida
+  /*!
+     Verifica as invariantes da árvore: ordem dos elementos, tamanho, alturas
+     guardadas nos nodos e fator de balanço entre -1 e 1 em todos eles.
+
+     \return true: Todas as invariantes valem.
+     \return false: Alguma invariante foi violada.
+   */
+  bool valid(void) const;
+
   //! Pré-ordem
   /*!
-     Percorre a árvore utilizando o algoritmo pré-ordem. Retorna uma lista com
-     os elementos na ordem percorrida.
+     Percorre a árvore utilizando o algoritmo pré-ordem (visit_pre_order).
+     Retorna uma lista com os elementos na ordem percorrida.
 
      \return lista: Lista (ArrayList<T>) com os elementos na ordem em que foram
      percorridos.
@@ -130,8 +311,8 @@ class AVLTree {
 
   //! Em-ordem
   /*!
-     Percorre a árvore utilizando o algoritmo em-ordem. Retorna uma lista com os
-     elementos na ordem percorrida.
+     Percorre a árvore utilizando o algoritmo em-ordem, com o iterador
+     const_iterator. Retorna uma lista com os elementos na ordem percorrida.
 
      \return lista: Lista (ArrayList<T>) com os elementos na ordem em que foram
      percorridos.
@@ -140,166 +321,155 @@ class AVLTree {
 
   //! Pós-ordem
   /*!
-     Percorre a árvore utilizando o algoritmo pós-ordem. Retorna uma lista com
-     os elementos na ordem percorrida.
+     Percorre a árvore utilizando o algoritmo pós-ordem (visit_post_order).
+     Retorna uma lista com os elementos na ordem percorrida.
 
      \return lista: Lista (ArrayList<T>) com os elementos na ordem em que foram
      percorridos.
    */
   ArrayList<T> post_order(void) const;
 
- private:
-  struct Node {
-    explicit Node(const T& data) : data_{data} {}
+  //! Visitar Pré-ordem
+  /*!
+     Chama visit com cada elemento, em pré-ordem, sem montar uma lista: a
+     pilha explícita guarda no máximo um nodo pendente por nível da árvore.
+     Se visit retornar bool, false interrompe o percurso.
 
-    ~Node(void) {
-      delete left_child;
-      delete right_child;
+     \param visit: Função chamada com cada elemento (const T&).
+   */
+  template <typename Visitor>
+  void visit_pre_order(Visitor&& visit) const {
+    std::vector<Index> stack;
+    if (root != NIL) {
+      stack.push_back(root);
+    }
+    while (!stack.empty()) {
+      const Node& node = arena_[stack.back()];
+      stack.pop_back();
+      if (!visit_data(visit, node.data_)) {
+        return;
+      }
+      // O filho da direita é empilhado antes para que o da esquerda saia
+      // antes.
+      if (node.right_child != NIL) {
+        stack.push_back(node.right_child);
+      }
+      if (node.left_child != NIL) {
+        stack.push_back(node.left_child);
+      }
     }
+  }
 
-    T data_;
-    int height_{0};
-    Node* left_child{nullptr};
-    Node* right_child{nullptr};
-
-    void insert(const T& data) {
-      if (data < data_) {
-        if (left_child == nullptr) {
-          left_child = new Node(data);
-          if (left_child == nullptr)
-            throw std::out_of_range("Cannot insert on full tree");
-        } else {
-          left_child->insert(data);
-        }
-      } else {
-        if (right_child == nullptr) {
-          right_child = new Node(data);
-          if (right_child == nullptr)
-            throw std::out_of_range("Cannot insert on full tree");
-        } else {
-          right_child->insert(data);
-        }
+  //! Visitar Em-ordem
+  /*!
+     Chama visit com cada elemento, em-ordem, pelo const_iterator. Se visit
+     retornar bool, false interrompe o percurso.
+
+     \param visit: Função chamada com cada elemento (const T&).
+   */
+  template <typename Visitor>
+  void visit_in_order(Visitor&& visit) const {
+    for (const auto& data : *this) {
+      if (!visit_data(visit, data)) {
+        return;
       }
     }
+  }
 
-    bool remove(const T& data) {
-      bool removed = false;
+  //! Visitar Pós-ordem
+  /*!
+     Chama visit com cada elemento, em pós-ordem, sem montar uma lista: a
+     pilha explícita guarda apenas os ancestrais do nodo atual. Se visit
+     retornar bool, false interrompe o percurso.
 
-      if (data < data_ && left_child != nullptr) {
-        left_child = remove(data, left_child, removed);
+     \param visit: Função chamada com cada elemento (const T&).
+   */
+  template <typename Visitor>
+  void visit_post_order(Visitor&& visit) const {
+    std::vector<Index> stack;
+    Index node = root;
+    Index visited = NIL;
+    while (node != NIL || !stack.empty()) {
+      if (node != NIL) {
+        stack.push_back(node);
+        node = arena_[node].left_child;
+        continue;
+      }
+      // A subárvore esquerda do topo já foi percorrida; o topo só sai depois
+      // da direita.
+      Index top = stack.back();
+      if (arena_[top].right_child != NIL &&
+          arena_[top].right_child != visited) {
+        node = arena_[top].right_child;
+      } else {
+        if (!visit_data(visit, arena_[top].data_)) {
+          return;
+        }
+        visited = top;
+        stack.pop_back();
+      }
+    }
+  }
 
-      } else if (data > data_ && right_child != nullptr) {
-        right_child = remove(data, right_child, removed);
+  //! Início Em-ordem
+  /*!
+     Iterador para o menor elemento da árvore.
 
-      } else if (data == data_) {
-        if (left_child != nullptr && right_child != nullptr) {
-          Node* tmp = right_child->minimum();
-          data_ = tmp->data_;
-          right_child = remove(data_, right_child, removed);
+     \return Iterador em-ordem (const_iterator).
+   */
+  const_iterator begin(void) const;
 
-        } else if (left_child != nullptr) {
-          Node* tmp = left_child;
+  //! Fim Em-ordem
+  /*!
+     Iterador após o maior elemento da árvore.
 
-          data_ = tmp->data_;
-          left_child = tmp->left_child;
-          right_child = tmp->right_child;
+     \return Iterador em-ordem (const_iterator).
+   */
+  const_iterator end(void) const;
 
-          tmp->left_child = nullptr;
-          tmp->right_child = nullptr;
+ private:
+  struct Node {
+    explicit Node(const T& data) : data_{data} {}
 
-          delete tmp;
+    template <typename... Args>
+    explicit Node(std::in_place_t, Args&&... args)
+        : data_(std::forward<Args>(args)...) {}
 
-          removed = true;
-        } else if (right_child != nullptr) {
-          Node* tmp = right_child;
+    T data_;
+    int height_{0};
+    Index left_child{NIL};
+    Index right_child{NIL};
+  };
 
-          data_ = tmp->data_;
-          left_child = tmp->left_child;
-          right_child = tmp->right_child;
+  //! Altura máxima de uma árvore AVL com até SIZE_MAX nodos (~1.44 log2 n).
+  static constexpr std::size_t MAX_HEIGHT = 96u;
 
-          tmp->left_child = nullptr;
-          tmp->right_child = nullptr;
+  //! Altura do nodo, ou -1 para NIL.
+  int height(Index node) const {
+    return node == NIL ? -1 : arena_[node].height_;
+  }
 
-          delete tmp;
+  //! Recalcula a altura do nodo a partir das alturas guardadas nos filhos.
+  void update_height(Index node) {
+    Node& n = arena_[node];
+    n.height_ = std::max(height(n.left_child), height(n.right_child)) + 1;
+  }
 
-          removed = true;
-        }
-      }
-      return removed;
-    }
+  //! Fator de balanço: altura da esquerda menos altura da direita.
+  int balance(Index node) const {
+    return height(arena_[node].left_child) - height(arena_[node].right_child);
+  }
 
-    bool contains(const T& data) const {
-      if (data < data_) {
-        if (left_child == nullptr)
-          return false;
-        else
-          return left_child->contains(data);
-      } else if (data > data_) {
-        if (right_child == nullptr)
-          return false;
-        else
-          return right_child->contains(data);
-      } else {
-        return true;
-      }
-    }
+  //! Rebalancear
+  /*!
+     Atualiza a altura do nodo e, se os filhos diferirem em mais de um nível,
+     aplica a rotação adequada. Os filhos já devem estar balanceados e com
+     alturas corretas.
 
-    void updateHeight(void) {
-      int height_left, height_right;
-      if (left_child == nullptr && right_child == nullptr) {
-        height_ = 0;
-      } else {
-        // Balança o filho da esquerda
-        if (left_child != nullptr) {
-          left_child->updateHeight();
-          switch (left_child->type_balance()) {
-            case 0:  // balanceado
-              height_left = left_child->left_child->height();
-              height_right = left_child->right_child->height();
-              left_child->height_ = std::max(height_left, height_right) + 1;
-              break;
-            case 1:  // Esquerda-esquerda
-              left_child = left_child->simpleLeft();
-              break;
-            case 2:  // Esquerda-direita
-              left_child = left_child->doubleLeft();
-              break;
-            case 3:  // Direita-direita
-              left_child = left_child->simpleRight();
-              break;
-            case 4:  // Direita-direita
-              left_child = left_child->doubleRight();
-              break;
-            default:
-              break;
-          }
-        }
-        if (right_child != nullptr) {
-          right_child->updateHeight();
-          switch (right_child->type_balance()) {
-            case 0:  // balanceado
-              height_left = right_child->left_child->height();
-              height_right = right_child->right_child->height();
-              right_child->height_ = std::max(height_left, height_right) + 1;
-              break;
-            case 1:  // Esquerda-esquerda
-              right_child = right_child->simpleLeft();
-              break;
-            case 2:  // Esquerda-direita
-              right_child = right_child->doubleLeft();
-              break;
-            case 3:  // Direita-direita
-              right_child = right_child->simpleRight();
-              break;
-            case 4:  // Direita-esquerda
-              right_child = right_child->doubleRight();
-              break;
-            default:
-              break;
-          }
-        }
-      }
-    }
+     \param node: Raiz da subárvore (Index).
+     \return Nova raiz da subárvore (Index).
+   */
+  Index rebalance(Index node);
 
   /* Rotações Simples:
      k1 e k2 são nodos. A, B e C são subárvores
@@ -311,27 +481,9 @@ class AVLTree {
      B    C   à direita     C    A
 
    */
-  Node* simpleLeft(void) {
-    Node* new_root = left_child;
-    left_child = new_root->right_child;
-    new_root->right_child = this;
-
-    height_ = std::max(left_child->height(), right_child->height() + 1);
-    new_root->height_ = std::max(new_root->left_child->height(), height()) + 1;
+  Index simpleLeft(Index node);
 
-    return new_root;
-  }
-
-  Node* simpleRight(void) {
-    Node* new_root = right_child;
-    right_child = new_root->left_child;
-    new_root->left_child = this;
-
-    height_ = std::max(right_child->height(), left_child->height() + 1);
-    new_root->height_ = std::max(new_root->right_child->height(), height()) + 1;
-
-    return new_root;
-  }
+  Index simpleRight(Index node);
 
   /* Rotações Duplas:
     k1, k2 e k3 são nodos. A, B, C e D são subárvores
@@ -345,102 +497,79 @@ class AVLTree {
           /  \
          B    C
   */
-  Node* doubleLeft(void) {
-    left_child = left_child->simpleRight();
-    return simpleLeft();
-  }
-
-  Node* doubleRight(void) {
-    right_child = right_child->simpleLeft();
-    return simpleRight();
-  }
+  Index doubleLeft(Index node);
 
-  void pre_order(ArrayList<T>& array) const {
-    if (this != nullptr) {
-      array.push_back(data_);
-      left_child->pre_order(array);
-      right_child->pre_order(array);
-    }
-  }
+  Index doubleRight(Index node);
 
-  void in_order(ArrayList<T>& array) const {
-    if (this != nullptr) {
-      left_child->in_order(array);
-      array.push_back(data_);
-      right_child->in_order(array);
-    }
-  }
+  //! Inserir Nodo
+  /*!
+     Pendura um nodo já construído na árvore AVL e rebalanceia apenas o
+     caminho de busca.
 
-  void post_order(ArrayList<T>& array) const {
-    if (this != nullptr) {
-      left_child->post_order(array);
-      right_child->post_order(array);
-      array.push_back(data_);
-    }
-  }
+     \param node: Nodo a ser inserido (Index).
+   */
+  void insert_node(Index node);
 
-  int height(void) {
-    if (this == nullptr) return -1;
+  //! Destruir Nodos
+  /*!
+     Libera todos os nodos. Se T tiver destrutor trivial, a arena é devolvida
+     de uma só vez, sem visitar os nodos; caso contrário, os nodos são
+     destruídos um a um, sem recursão, antes disso.
+   */
+  void destroy(void);
 
-    return height_;
-  }
+  //! Desfazer em Sequência
+  /*!
+     Reorganiza os nodos de node, por rotações e sem alocar, em uma sequência
+     em-ordem encadeada pelos filhos da direita.
 
-    std::size_t type_balance(void) {
-      if (left_child->height() - right_child->height() > 1) {
-        if (left_child->left_child->height() > left_child->right_child->height())
-          return 1;
-        else
-          return 2;
-      } else if (right_child->height() - left_child->height() > 1) {
-        if (right_child->right_child->height() > right_child->left_child->height())
-          return 3;
-        else
-          return 4;
-      }
-      return 0;
-    }
+     \param node: Raiz da subárvore (Index).
+     \return Primeiro nodo da sequência (Index).
+   */
+  Index flatten(Index node);
 
+  //! Construir Balanceada
+  /*!
+     Liga os count primeiros nodos de vine, uma sequência em-ordem encadeada
+     pelos filhos da direita, em uma árvore perfeitamente balanceada, e avança
+     vine para depois deles. A recursão tem profundidade log2(count).
 
- private:
-  Node* minimum(void) {
-    if (left_child == nullptr) return this;
-    return left_child->minimum();
-  }
+     \param vine: Sequência de nodos (Index&).
+     \param count: Quantidade de nodos a ligar (size_t).
+     \return Raiz da árvore (Index).
+   */
+  Index build(Index& vine, std::size_t count);
 
-     Node* remove(const T& data, Node* tree, bool& removed) {
-      removed = false;
-      if (tree == nullptr) return tree;
-      if (data < tree->data_) {
-        tree->left_child = remove(data, tree->left_child, removed);
-        return tree;
-      }
-      if (data > tree->data_) {
-        tree->right_child = remove(data, tree->right_child, removed);
-        return tree;
-      }
-      if (tree->right_child != nullptr && tree->left_child != nullptr) {
-        Node* tmp = tree->right_child->minimum();
-        tree->data_ = tmp->data_;
-        tree->right_child = remove(data, tree->right_child, removed);
-        return tree;
-      }
-      Node* tmp = nullptr;
-      if (tree->right_child != nullptr)
-        tmp = tree->right_child;
-      else
-        tmp = tree->left_child;
-
-      tree->right_child = tree->left_child = nullptr;
-      delete tree;
-      removed = true;
-      return tmp;
-    }
+  //! Retraçar
+  /*!
+     Sobe pelo caminho de busca, do nodo mais fundo até a raiz, rebalanceando
+     cada subárvore. Para assim que uma subárvore mantém a altura que tinha,
+     pois os ancestrais dela não mudam: cada inserção ou remoção custa
+     O(log n).
 
+     \param path: Ligações (Index*) da raiz até o pai do nodo alterado.
+     \param depth: Quantidade de ligações em path (size_t).
+   */
+  void retrace(Index* path[], std::size_t depth);
 
- };
+  //! Visitar Dado
+  /*!
+     Chama visit com data. Retorna false apenas se visit retornar um bool
+     falso, pedindo o fim do percurso.
+   */
+  template <typename Visitor>
+  static bool visit_data(Visitor& visit, const T& data) {
+    if constexpr (std::is_void_v<std::invoke_result_t<Visitor&, const T&>>) {
+      visit(data);
+      return true;
+    } else {
+      return static_cast<bool>(visit(data));
+    }
+  }
 
-Node* root{nullptr};
-std::size_t size_{0u};
+  NodeArena<Node> arena_;
+  Index root{NIL};
+  std::size_t size_{0u};
 };
 
 }// namespace structures
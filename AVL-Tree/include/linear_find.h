@@ -0,0 +1,170 @@
+#ifndef STRUCTURES_LINEAR_FIND_H_
+#define STRUCTURES_LINEAR_FIND_H_
+
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace structures {
+//! Função busca linear escalar
+/*!
+   Percorre contents elemento a elemento procurando data.
+
+   \param contents: Vetor de elementos (const T*).
+   \param size: Quantidade de elementos em contents (size_t).
+   \param data: Referência constante ao elemento buscado (const T&).
+   \return Posição da primeira ocorrência de data, ou size (size_t).
+ */
+template <typename T>
+std::size_t scalar_find(const T* contents, std::size_t size, const T& data) {
+  std::size_t index = 0;
+  while (index != size && !(data == contents[index])) {
+    index++;
+  }
+  return index;
+}
+
+//! Busca vetorizada disponível
+/*!
+   Verdadeiro se T pode ser buscado com instruções SIMD: inteiros e ponto
+   flutuante de precisão simples e dupla, em alvos com SSE2 ou AVX2. SSE2 não
+   compara inteiros de 64 bits, que usam a busca escalar sem AVX2.
+ */
+template <typename T>
+struct VectorFindable
+    : std::integral_constant<bool,
+#if defined(__AVX2__)
+                             std::is_integral<T>::value ||
+                                 std::is_same<T, float>::value ||
+                                 std::is_same<T, double>::value
+#elif defined(__SSE2__)
+                             (std::is_integral<T>::value && sizeof(T) <= 4) ||
+                                 std::is_same<T, float>::value ||
+                                 std::is_same<T, double>::value
+#else
+                             false
+#endif
+                             > {
+};
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#if defined(__AVX2__)
+//! Bytes por bloco comparado de uma vez.
+const std::size_t VECTOR_BYTES = 32;
+
+//! Função máscara de igualdade
+/*!
+   Compara um bloco de VECTOR_BYTES bytes a partir de block com data. Retorna
+   uma máscara com um bit por byte, ligado nos bytes dos elementos iguais.
+ */
+template <typename T>
+std::uint32_t equal_mask(const T* block, const T& data) {
+  if constexpr (std::is_same<T, float>::value) {
+    __m256 equal =
+        _mm256_cmp_ps(_mm256_loadu_ps(block), _mm256_set1_ps(data), _CMP_EQ_OQ);
+    return _mm256_movemask_epi8(_mm256_castps_si256(equal));
+  } else if constexpr (std::is_same<T, double>::value) {
+    __m256d equal =
+        _mm256_cmp_pd(_mm256_loadu_pd(block), _mm256_set1_pd(data), _CMP_EQ_OQ);
+    return _mm256_movemask_epi8(_mm256_castpd_si256(equal));
+  } else {
+    __m256i values =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+    __m256i equal;
+    if constexpr (sizeof(T) == 1) {
+      equal = _mm256_cmpeq_epi8(values, _mm256_set1_epi8(data));
+    } else if constexpr (sizeof(T) == 2) {
+      equal = _mm256_cmpeq_epi16(values, _mm256_set1_epi16(data));
+    } else if constexpr (sizeof(T) == 4) {
+      equal = _mm256_cmpeq_epi32(values, _mm256_set1_epi32(data));
+    } else {
+      equal = _mm256_cmpeq_epi64(values, _mm256_set1_epi64x(data));
+    }
+    return _mm256_movemask_epi8(equal);
+  }
+}
+#else
+//! Bytes por bloco comparado de uma vez.
+const std::size_t VECTOR_BYTES = 16;
+
+//! Função máscara de igualdade
+/*!
+   Compara um bloco de VECTOR_BYTES bytes a partir de block com data. Retorna
+   uma máscara com um bit por byte, ligado nos bytes dos elementos iguais.
+ */
+template <typename T>
+std::uint32_t equal_mask(const T* block, const T& data) {
+  if constexpr (std::is_same<T, float>::value) {
+    __m128 equal = _mm_cmpeq_ps(_mm_loadu_ps(block), _mm_set1_ps(data));
+    return _mm_movemask_epi8(_mm_castps_si128(equal));
+  } else if constexpr (std::is_same<T, double>::value) {
+    __m128d equal = _mm_cmpeq_pd(_mm_loadu_pd(block), _mm_set1_pd(data));
+    return _mm_movemask_epi8(_mm_castpd_si128(equal));
+  } else {
+    __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+    __m128i equal;
+    if constexpr (sizeof(T) == 1) {
+      equal = _mm_cmpeq_epi8(values, _mm_set1_epi8(data));
+    } else if constexpr (sizeof(T) == 2) {
+      equal = _mm_cmpeq_epi16(values, _mm_set1_epi16(data));
+    } else {
+      equal = _mm_cmpeq_epi32(values, _mm_set1_epi32(data));
+    }
+    return _mm_movemask_epi8(equal);
+  }
+}
+#endif
+
+//! Função busca linear vetorizada
+/*!
+   Procura data comparando VECTOR_BYTES bytes por instrução e termina os
+   elementos restantes com scalar_find. Só deve ser usada quando
+   VectorFindable<T> for verdadeiro.
+
+   \param contents: Vetor de elementos (const T*).
+   \param size: Quantidade de elementos em contents (size_t).
+   \param data: Referência constante ao elemento buscado (const T&).
+   \return Posição da primeira ocorrência de data, ou size (size_t).
+ */
+template <typename T>
+std::size_t vector_find(const T* contents, std::size_t size, const T& data) {
+  const std::size_t lanes = VECTOR_BYTES / sizeof(T);
+  std::size_t index = 0;
+  for (; index + lanes <= size; index += lanes) {
+    std::uint32_t mask = equal_mask(contents + index, data);
+    if (mask != 0) {
+      return index + __builtin_ctz(mask) / sizeof(T);
+    }
+  }
+  return index + scalar_find(contents + index, size - index, data);
+}
+#endif
+
+//! Função busca linear
+/*!
+   Procura data em contents, usando vector_find quando o tipo permite
+   (VectorFindable) e scalar_find nos demais casos. A escolha é feita em tempo
+   de compilação.
+
+   \param contents: Vetor de elementos (const T*).
+   \param size: Quantidade de elementos em contents (size_t).
+   \param data: Referência constante ao elemento buscado (const T&).
+   \return Posição da primeira ocorrência de data, ou size (size_t).
+ */
+template <typename T>
+std::size_t linear_find(const T* contents, std::size_t size, const T& data) {
+#if defined(__AVX2__) || defined(__SSE2__)
+  if constexpr (VectorFindable<T>::value) {
+    return vector_find(contents, size, data);
+  }
+#endif
+  return scalar_find(contents, size, data);
+}
+}  // namespace structures
+
+#endif
@@ -0,0 +1,253 @@
+#ifndef STRUCTURES_NODE_ARENA_H_
+#define STRUCTURES_NODE_ARENA_H_
+
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace structures {
+//! Classe NodeArena
+/*!
+   Arena de nodos de árvore. Os nodos vivem em blocos contíguos, de tamanho
+   crescente até MAX_BLOCK_SIZE, e são identificados por índices de 32 bits
+   em vez de ponteiros: em plataformas de 64 bits, cada ligação entre nodos
+   ocupa metade do espaço, e nenhum nodo paga o cabeçalho de uma alocação
+   individual. Nodos liberados vão para uma lista livre e são reutilizados.
+
+   O índice NIL nunca é entregue e representa a ausência de nodo. Os blocos
+   são devolvidos ao sistema de uma só vez, sem visitar os nodos; por isso
+   nodos com destrutor não trivial devem ser destruídos (destroy) antes de
+   clear ou do destrutor da arena.
+ */
+template <typename Node>
+class NodeArena {
+ public:
+  //! Índice de um nodo
+  using Index = std::uint32_t;
+
+  //! Índice que não identifica nenhum nodo
+  static constexpr Index NIL = 0u;
+
+  //! Construtor
+  /*!
+     Cria uma arena sem blocos; o primeiro bloco é reservado no primeiro
+     nodo.
+   */
+  NodeArena(void) = default;
+
+  //! Construtor de movimento
+  /*!
+     Toma para si os blocos de other, que fica sem blocos. Os índices dos
+     nodos de other continuam válidos nesta arena.
+
+     \param other: Arena de origem (NodeArena&&).
+   */
+  NodeArena(NodeArena&& other) noexcept { take(other); }
+
+  NodeArena(const NodeArena&) = delete;
+  NodeArena& operator=(const NodeArena&) = delete;
+
+  //! Destrutor
+  /*!
+     Devolve todos os blocos ao sistema.
+   */
+  ~NodeArena(void) { release(); }
+
+  //! Atribuição por movimento
+  /*!
+     Devolve os blocos atuais ao sistema e toma para si os blocos de other.
+
+     \param other: Arena de origem (NodeArena&&).
+     \return Referência para esta arena (NodeArena&).
+   */
+  NodeArena& operator=(NodeArena&& other) noexcept {
+    if (this != &other) {
+      release();
+      take(other);
+    }
+    return *this;
+  }
+
+  //! Método cria
+  /*!
+     Constrói um nodo, repassando args ao construtor de Node, em um espaço da
+     lista livre ou, se ela estiver vazia, no próximo espaço nunca usado.
+     Lança exceção (out_of_range) se os índices de 32 bits se esgotarem.
+
+     \param args: Argumentos repassados ao construtor de Node.
+     \return Índice do nodo (Index).
+   */
+  template <typename... Args>
+  Index make(Args&&... args) {
+    Index index;
+    if (free_ != NIL) {
+      index = free_;
+      free_ = slot(index)->next;
+    } else {
+      if (next_ == capacity_) {
+        grow();
+      }
+      index = next_++;
+    }
+    try {
+      new (slot(index)->storage) Node(std::forward<Args>(args)...);
+    } catch (...) {
+      slot(index)->next = free_;
+      free_ = index;
+      throw;
+    }
+    return index;
+  }
+
+  //! Método reserva
+  /*!
+     Reserva blocos até que os próximos count nodos caibam em espaços nunca
+     usados, sem contar a lista livre; depois disso, criar esses nodos não
+     aloca memória. Lança exceção (bad_alloc ou out_of_range) sem alterar os
+     nodos existentes se não conseguir reservar.
+
+     \param count: Quantidade de nodos (size_t).
+   */
+  void reserve(std::size_t count) {
+    while (capacity_ - next_ < count) {
+      grow();
+    }
+  }
+
+  //! Método destrói
+  /*!
+     Destrói o nodo index e devolve seu espaço à lista livre.
+
+     \param index: Índice do nodo (Index).
+   */
+  void destroy(Index index) {
+    (*this)[index].~Node();
+    slot(index)->next = free_;
+    free_ = index;
+  }
+
+  //! Sobrecarga do operador []
+  /*!
+     Nodo de índice index, que não pode ser NIL.
+
+     \param index: Índice do nodo (Index).
+     \return Referência para o nodo (Node&).
+   */
+  Node& operator[](Index index) {
+    return *reinterpret_cast<Node*>(slot(index)->storage);
+  }
+
+  //! Sobrecarga do operador [] constante
+  const Node& operator[](Index index) const {
+    return *reinterpret_cast<const Node*>(slot(index)->storage);
+  }
+
+  //! Método limpa
+  /*!
+     Devolve todos os blocos ao sistema de uma só vez, em O(blocos), sem
+     visitar os nodos.
+   */
+  void clear(void) { release(); }
+
+ private:
+  //! Espaço de um nodo
+  /*!
+     Enquanto livre, guarda o índice do próximo espaço da lista livre.
+   */
+  union Slot {
+    Index next;
+    alignas(Node) unsigned char storage[sizeof(Node)];
+  };
+
+  //! Espaços no primeiro bloco, em potência de 2
+  static constexpr unsigned FIRST_BLOCK_SHIFT = 5u;
+
+  //! Máximo de espaços por bloco, em potência de 2
+  static constexpr unsigned MAX_BLOCK_SHIFT = 12u;
+
+  static constexpr Index FIRST_BLOCK_SIZE = Index{1} << FIRST_BLOCK_SHIFT;
+  static constexpr Index MAX_BLOCK_SIZE = Index{1} << MAX_BLOCK_SHIFT;
+
+  //! Método espaço
+  /*!
+     Localiza o espaço de index sem laços. Os índices abaixo de
+     MAX_BLOCK_SIZE ficam em blocos que dobram de tamanho (os dois primeiros
+     com FIRST_BLOCK_SIZE espaços, depois 2x, 4x, ...): o bloco é dado pelo
+     bit mais alto do índice. Os demais ficam em blocos de MAX_BLOCK_SIZE.
+   */
+  Slot* slot(Index index) const {
+    if (index >= MAX_BLOCK_SIZE) {
+      return blocks_[(index >> MAX_BLOCK_SHIFT) + MAX_BLOCK_SHIFT -
+                     FIRST_BLOCK_SHIFT] +
+             (index & (MAX_BLOCK_SIZE - 1));
+    }
+    unsigned high = 31u - __builtin_clz(index | (FIRST_BLOCK_SIZE - 1));
+    Index start = (Index{1} << high) & ~(FIRST_BLOCK_SIZE - 1);
+    return blocks_[high + 1 - FIRST_BLOCK_SHIFT] + (index - start);
+  }
+
+  //! Método cresce
+  /*!
+     Reserva o próximo bloco. O espaço de índice NIL, no primeiro bloco,
+     nunca é usado.
+   */
+  void grow(void) {
+    if (capacity_ > UINT32_MAX - MAX_BLOCK_SIZE) {
+      throw std::out_of_range("Node arena is full");
+    }
+    Index size = capacity_ < MAX_BLOCK_SIZE
+                     ? (capacity_ == 0 ? FIRST_BLOCK_SIZE : capacity_)
+                     : MAX_BLOCK_SIZE;
+    blocks_.reserve(blocks_.size() + 1);
+    blocks_.push_back(
+        static_cast<Slot*>(::operator new(size * sizeof(Slot))));
+    if (capacity_ == 0) {
+      next_ = 1u;
+    }
+    capacity_ += size;
+  }
+
+  //! Método devolve
+  /*!
+     Devolve todos os blocos ao sistema.
+   */
+  void release(void) {
+    for (Slot* block : blocks_) {
+      ::operator delete(block);
+    }
+    blocks_.clear();
+    free_ = NIL;
+    next_ = 0u;
+    capacity_ = 0u;
+  }
+
+  //! Método toma
+  /*!
+     Toma para si o estado de other, que fica sem blocos. Não devolve os
+     blocos atuais.
+   */
+  void take(NodeArena& other) {
+    blocks_ = std::move(other.blocks_);
+    other.blocks_.clear();
+    free_ = std::exchange(other.free_, NIL);
+    next_ = std::exchange(other.next_, 0u);
+    capacity_ = std::exchange(other.capacity_, 0u);
+  }
+
+  //! Blocos reservados, na ordem dos índices
+  std::vector<Slot*> blocks_;
+
+  //! Lista livre
+  Index free_{NIL};
+
+  //! Próximo índice nunca usado
+  Index next_{0u};
+
+  //! Espaços em todos os blocos
+  Index capacity_{0u};
+};
+}  // namespace structures
+
+#endif
@@ -1,90 +1,267 @@
 #include "../include/avl_tree.h"
 
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+template <typename T>
+structures::AVLTree<T>::AVLTree(AVLTree&& other)
+    : arena_{std::move(other.arena_)} {
+  root = other.root;
+  size_ = other.size_;
+  other.root = NIL;
+  other.size_ = 0u;
+}
+
 template <typename T>
 structures::AVLTree<T>::~AVLTree(void) {
-  delete root;
+  destroy();
+}
+
+template <typename T>
+structures::AVLTree<T>& structures::AVLTree<T>::operator=(AVLTree&& other) {
+  if (this != &other) {
+    destroy();
+    arena_ = std::move(other.arena_);
+    root = other.root;
+    size_ = other.size_;
+    other.root = NIL;
+    other.size_ = 0u;
+  }
+  return *this;
 }
 
 template <typename T>
 void structures::AVLTree<T>::insert(const T& data) {
-  if (empty()) {
-    root = new Node(data);
-    if (root == nullptr) throw std::out_of_range("Cannot insert on full tree");
-  } else {
-    root->insert(data);
+  emplace(data);
+}
+
+template <typename T>
+void structures::AVLTree<T>::insert(T&& data) {
+  emplace(std::move(data));
+}
+
+template <typename T>
+void structures::AVLTree<T>::insert_node(Index node) {
+  Index* path[MAX_HEIGHT];
+  std::size_t depth = 0u;
+
+  const T& data = arena_[node].data_;
+  Index* link = &root;
+  while (*link != NIL) {
+    path[depth++] = link;
+    Node& parent = arena_[*link];
+    if (data < parent.data_) {
+      link = &parent.left_child;
+    } else {
+      link = &parent.right_child;
+    }
   }
+  *link = node;
   ++size_;
 
-  int h_left, h_right;
-  root->updateHeight();
-  switch (root->type_balance()) {
-    case 0:
-      h_left = root->left_child->height();
-      h_right = root->right_child->height();
-      root->height_ = std::max(h_left, h_right) + 1;
-      break;
-    case 1:
-      root = root->simpleLeft();
-      break;
-    case 2:
-      root = root->doubleLeft();
-      break;
-    case 3:
-      root = root->simpleRight();
-      break;
-    case 4:
-      root = root->doubleRight();
-      break;
-    default:
-      break;
+  retrace(path, depth);
+}
+
+template <typename T>
+void structures::AVLTree<T>::merge(AVLTree&& other) {
+  if (this == &other || other.empty()) return;
+  if (empty()) {
+    *this = std::move(other);
+    return;
+  }
+
+  // Reserva antes de desfazer as árvores: os nodos de other são criados
+  // nesta arena sem alocar, e uma falha de alocação deixa as duas intactas.
+  arena_.reserve(other.size_);
+  Index left = flatten(root);
+  Index right = other.flatten(other.root);
+  other.root = NIL;
+  Index vine = NIL;
+  Index* tail = &vine;
+  while (left != NIL || right != NIL) {
+    // Em empates, os elementos desta árvore vêm antes.
+    if (right == NIL ||
+        (left != NIL && !(other.arena_[right].data_ < arena_[left].data_))) {
+      *tail = left;
+      left = arena_[left].right_child;
+    } else {
+      Index taken = right;
+      Node& moved = other.arena_[taken];
+      *tail = arena_.make(std::in_place, std::move(moved.data_));
+      right = moved.right_child;
+      other.arena_.destroy(taken);
+    }
+    tail = &arena_[*tail].right_child;
   }
+
+  size_ += other.size_;
+  root = build(vine, size_);
+  other.size_ = 0u;
+  other.arena_.clear();
+}
+
+template <typename T>
+typename structures::AVLTree<T>::Index structures::AVLTree<T>::flatten(
+    Index node) {
+  Index vine = NIL;
+  Index* tail = &vine;
+  while (node != NIL) {
+    Node& current = arena_[node];
+    if (current.left_child != NIL) {
+      Index left = current.left_child;
+      current.left_child = arena_[left].right_child;
+      arena_[left].right_child = node;
+      node = left;
+    } else {
+      *tail = node;
+      tail = &current.right_child;
+      node = current.right_child;
+    }
+  }
+  return vine;
+}
+
+template <typename T>
+typename structures::AVLTree<T>::Index structures::AVLTree<T>::build(
+    Index& vine, std::size_t count) {
+  if (count == 0u) return NIL;
+
+  Index left = build(vine, count / 2);
+  Index node = vine;
+  vine = arena_[node].right_child;
+  arena_[node].left_child = left;
+  arena_[node].right_child = build(vine, count - count / 2 - 1);
+  update_height(node);
+  return node;
 }
 
 template <typename T>
 void structures::AVLTree<T>::remove(const T& data) {
   if (empty()) throw std::out_of_range("Cannot remove from empty tree");
 
-  if (size() != 1u) {
-    if (root->remove(data)) {
-      --size_;
-      int h_left, h_right;
-      root->updateHeight();
-      switch (root->type_balance()) {
-        case 0:  // balanceado
-          h_left = root->left_child->height();
-          h_right = root->right_child->height();
-          root->height_ = std::max(h_left, h_right) + 1;
-          break;
-        case 1:
-          root = root->simpleLeft();
-          break;
-        case 2:
-          root = root->doubleLeft();
-          break;
-        case 3:
-          root = root->simpleRight();
-          break;
-        case 4:
-          root = root->doubleRight();
-          break;
-        default:
-          break;
-      }
+  Index* path[MAX_HEIGHT];
+  std::size_t depth = 0u;
+
+  Index* link = &root;
+  while (*link != NIL && !(arena_[*link].data_ == data)) {
+    path[depth++] = link;
+    if (data < arena_[*link].data_) {
+      link = &arena_[*link].left_child;
+    } else {
+      link = &arena_[*link].right_child;
     }
-  } else {
-    if (root->data_ == data) {
-      delete root;
-      root = nullptr;
-      --size_;
+  }
+  if (*link == NIL) return;
+
+  Index node = *link;
+  if (arena_[node].left_child != NIL && arena_[node].right_child != NIL) {
+    // Dois filhos: o sucessor toma o lugar do dado removido, e é o nodo do
+    // sucessor que sai da árvore. O caminho segue até o pai dele.
+    path[depth++] = link;
+    Index* successor = &arena_[node].right_child;
+    while (arena_[*successor].left_child != NIL) {
+      path[depth++] = successor;
+      successor = &arena_[*successor].left_child;
     }
+    arena_[node].data_ = std::move(arena_[*successor].data_);
+    link = successor;
+    node = *link;
   }
+
+  const Node& removed = arena_[node];
+  *link = removed.left_child != NIL ? removed.left_child : removed.right_child;
+  arena_.destroy(node);
+  --size_;
+
+  retrace(path, depth);
 }
 
 template <typename T>
-bool structures::AVLTree<T>::contains(const T& data) const {
-  if (empty()) return false;
+void structures::AVLTree<T>::retrace(Index* path[], std::size_t depth) {
+  while (depth != 0u) {
+    Index* link = path[--depth];
+    int height = arena_[*link].height_;
+    *link = rebalance(*link);
+    if (arena_[*link].height_ == height) break;
+  }
+}
 
-  return root->contains(data);
+template <typename T>
+typename structures::AVLTree<T>::Index structures::AVLTree<T>::rebalance(
+    Index node) {
+  update_height(node);
+  int factor = balance(node);
+  if (factor > 1) {
+    // Esquerda-esquerda ou esquerda-direita.
+    return balance(arena_[node].left_child) >= 0 ? simpleLeft(node)
+                                                 : doubleLeft(node);
+  }
+  if (factor < -1) {
+    // Direita-direita ou direita-esquerda.
+    return balance(arena_[node].right_child) <= 0 ? simpleRight(node)
+                                                  : doubleRight(node);
+  }
+  return node;
+}
+
+template <typename T>
+typename structures::AVLTree<T>::Index structures::AVLTree<T>::simpleLeft(
+    Index node) {
+  Index new_root = arena_[node].left_child;
+  arena_[node].left_child = arena_[new_root].right_child;
+  arena_[new_root].right_child = node;
+
+  update_height(node);
+  update_height(new_root);
+
+  return new_root;
+}
+
+template <typename T>
+typename structures::AVLTree<T>::Index structures::AVLTree<T>::simpleRight(
+    Index node) {
+  Index new_root = arena_[node].right_child;
+  arena_[node].right_child = arena_[new_root].left_child;
+  arena_[new_root].left_child = node;
+
+  update_height(node);
+  update_height(new_root);
+
+  return new_root;
+}
+
+template <typename T>
+typename structures::AVLTree<T>::Index structures::AVLTree<T>::doubleLeft(
+    Index node) {
+  arena_[node].left_child = simpleRight(arena_[node].left_child);
+  return simpleLeft(node);
+}
+
+template <typename T>
+typename structures::AVLTree<T>::Index structures::AVLTree<T>::doubleRight(
+    Index node) {
+  arena_[node].right_child = simpleLeft(arena_[node].right_child);
+  return simpleRight(node);
+}
+
+template <typename T>
+bool structures::AVLTree<T>::contains(const T& data) const {
+  Index node = root;
+  while (node != NIL) {
+    const Node& current = arena_[node];
+    if (data < current.data_) {
+      node = current.left_child;
+    } else if (data > current.data_) {
+      node = current.right_child;
+    } else {
+      return true;
+    }
+  }
+  return false;
 }
 
 template <typename T>
@@ -99,8 +276,8 @@ bool structures::AVLTree<T>::empty(void) const {
 
 template <typename T>
 structures::ArrayList<T> structures::AVLTree<T>::pre_order(void) const {
-  structures::ArrayList<T> array{size()};
-  if (!empty()) root->pre_order(array);
+  structures::ArrayList<T> array{size_};
+  visit_pre_order([&array](const T& data) { array.push_back(data); });
 
   return array;
 }
@@ -108,7 +285,7 @@ structures::ArrayList<T> structures::AVLTree<T>::pre_order(void) const {
 template <typename T>
 structures::ArrayList<T> structures::AVLTree<T>::in_order(void) const {
   structures::ArrayList<T> array{size_};
-  if (!empty()) root->in_order(array);
+  for (const auto& data : *this) array.push_back(data);
 
   return array;
 }
@@ -116,14 +293,78 @@ structures::ArrayList<T> structures::AVLTree<T>::in_order(void) const {
 template <typename T>
 structures::ArrayList<T> structures::AVLTree<T>::post_order(void) const {
   structures::ArrayList<T> array{size_};
-  if (!empty()) root->post_order(array);
+  visit_post_order([&array](const T& data) { array.push_back(data); });
 
   return array;
 }
 
+template <typename T>
+typename structures::AVLTree<T>::const_iterator
+structures::AVLTree<T>::begin(void) const {
+  return const_iterator{arena_, root};
+}
+
+template <typename T>
+typename structures::AVLTree<T>::const_iterator
+structures::AVLTree<T>::end(void) const {
+  return const_iterator{};
+}
+
+template <typename T>
+void structures::AVLTree<T>::destroy(void) {
+  if (!std::is_trivially_destructible<T>::value) {
+    Index node = root;
+    while (node != NIL) {
+      Node& current = arena_[node];
+      if (current.left_child != NIL) {
+        // Rotação à direita: o filho da esquerda sobe, sem alocar pilha.
+        Index left = current.left_child;
+        current.left_child = arena_[left].right_child;
+        arena_[left].right_child = node;
+        node = left;
+      } else {
+        Index right = current.right_child;
+        arena_.destroy(node);
+        node = right;
+      }
+    }
+  }
+  arena_.clear();
+  root = NIL;
+  size_ = 0u;
+}
+
 template <typename T>
 int structures::AVLTree<T>::height() const {
-  return root->height();
+  return height(root);
+}
+
+template <typename T>
+bool structures::AVLTree<T>::valid(void) const {
+  std::size_t count = 0u;
+  const T* previous = nullptr;
+  for (const auto& data : *this) {
+    if (previous != nullptr && data < *previous) return false;
+    previous = &data;
+    ++count;
+  }
+  if (count != size_) return false;
+
+  // Cada nodo confere apenas os filhos: se todas as alturas guardadas estão
+  // corretas localmente, estão corretas na árvore inteira.
+  std::vector<Index> stack;
+  if (root != NIL) stack.push_back(root);
+  while (!stack.empty()) {
+    const Node& node = arena_[stack.back()];
+    stack.pop_back();
+    int left = height(node.left_child);
+    int right = height(node.right_child);
+    if (node.height_ != std::max(left, right) + 1) return false;
+    if (left - right > 1 || right - left > 1) return false;
+    if (node.left_child != NIL) stack.push_back(node.left_child);
+    if (node.right_child != NIL) stack.push_back(node.right_child);
+  }
+  return true;
 }
 
 template class structures::AVLTree<int>;
@@ -1,7 +1,45 @@
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <set>
+
 #include "../include/avl_tree.h"
 #include "../include/array_list.h"
 #include "gtest/gtest.h"
 
+namespace {
+/**
+ * Alocações que ainda podem ser feitas antes de o operator new lançar
+ * std::bad_alloc; negativo, nenhuma falha.
+ */
+long allocations_left = -1;
+
+/**
+ * Devolve memória ao malloc fora de linha: expandido junto de um new, o
+ * std::free acusaria -Wmismatched-new-delete.
+ */
+__attribute__((noinline)) void release(void* pointer) {
+    std::free(pointer);
+}
+}  // namespace
+
+void* operator new(std::size_t size) {
+    if (allocations_left == 0) {
+        throw std::bad_alloc();
+    } else if (allocations_left > 0) {
+        --allocations_left;
+    }
+    void* pointer = std::malloc(size == 0 ? 1 : size);
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void operator delete(void* pointer) noexcept { release(pointer); }
+
+void operator delete(void* pointer, std::size_t) noexcept { release(pointer); }
 
 /**
  * Classe com propósito de oferecer maior robustez aos testes.
@@ -352,6 +390,256 @@ TEST_F(AVLTreeTest, PostOrder) {
 }
 
 
+/**
+ * Testa se o construtor de movimento toma os nodos da árvore de origem.
+ */
+TEST_F(AVLTreeTest, MoveConstruction) {
+    multiple_insertion(int_list, int_values);
+    structures::AVLTree<int> moved{std::move(int_list)};
+    ASSERT_EQ(int_values.size(), moved.size());
+    contains_all(moved, int_values);
+    ASSERT_TRUE(int_list.empty());
+    int_list.insert(1);
+    ASSERT_TRUE(int_list.contains(1));
+}
+
+/**
+ * Testa a inserção por movimento e a construção no lugar de strings.
+ */
+TEST_F(AVLTreeTest, StringMoveAndEmplace) {
+    std::string moved = string_values[3];
+    string_list.insert(std::move(moved));
+    ASSERT_TRUE(moved.empty());
+    string_list.emplace(3u, 'Z');
+    string_list.emplace("AAA");
+    ASSERT_EQ(3u, string_list.size());
+    ASSERT_TRUE(string_list.contains(string_values[3]));
+    ASSERT_TRUE(string_list.contains("ZZZ"));
+    auto inordered = string_list.in_order();
+    ASSERT_EQ("AAA", inordered[0]);
+    ASSERT_EQ("ZZZ", inordered[2]);
+}
+
+/**
+ * Testa se o iterador percorre a árvore em-ordem sob demanda.
+ */
+TEST_F(AVLTreeTest, IteratorVisitsInOrder) {
+    ASSERT_TRUE(int_list.begin() == int_list.end());
+    multiple_insertion(int_list, int_values);
+
+    auto inordered = int_list.in_order();
+    auto i = 0u;
+    for (const auto& value : int_list) {
+        ASSERT_EQ(inordered[i], value);
+        ++i;
+    }
+    ASSERT_EQ(int_values.size(), i);
+
+    auto it = dummy_list.begin();
+    ASSERT_TRUE(it == dummy_list.end());
+    multiple_insertion(dummy_list, dummy_values);
+    it = dummy_list.begin();
+    ASSERT_EQ(structures::Dummy{-10.}, *it++);
+    ASSERT_EQ(-5.5, it->value());
+}
+
+/**
+ * Testa se os visitantes seguem as ordens dos percursos e param quando a
+ * função retorna false.
+ */
+TEST_F(AVLTreeTest, Visitors) {
+    multiple_insertion(int_list, int_values);
+
+    auto preordered = int_list.pre_order();
+    auto i = 0u;
+    int_list.visit_pre_order([&](int value) {
+        ASSERT_EQ(preordered[i], value);
+        ++i;
+    });
+    ASSERT_EQ(int_values.size(), i);
+
+    auto postordered = int_list.post_order();
+    i = 0u;
+    int_list.visit_post_order([&](int value) {
+        ASSERT_EQ(postordered[i], value);
+        ++i;
+    });
+    ASSERT_EQ(int_values.size(), i);
+
+    auto visited = std::vector<int>{};
+    int_list.visit_in_order([&](int value) {
+        visited.push_back(value);
+        return value < 5;
+    });
+    ASSERT_EQ((std::vector<int>{-15, -10, -5, 5}), visited);
+}
+
+/**
+ * Testa as invariantes AVL e a altura logarítmica com chaves em ordem, que
+ * degenerariam uma árvore binária de busca comum.
+ */
+TEST_F(AVLTreeTest, SortedInsertionKeepsBalance) {
+    ASSERT_EQ(-1, int_list.height());
+    const auto count = 1 << 16;
+    for (auto i = 0; i < count; ++i) {
+        int_list.insert(i);
+    }
+    ASSERT_TRUE(int_list.valid());
+    // Inserções em ordem formam uma árvore perfeita menos o último nível.
+    ASSERT_EQ(16, int_list.height());
+
+    for (auto i = 0; i < count; i += 2) {
+        int_list.remove(i);
+    }
+    ASSERT_TRUE(int_list.valid());
+    ASSERT_EQ(count / 2u, int_list.size());
+    ASSERT_FALSE(int_list.contains(0));
+    ASSERT_TRUE(int_list.contains(count - 1));
+}
+
+/**
+ * Testa as invariantes AVL depois de cada operação em uma sequência
+ * aleatória de inserções e remoções, inclusive de valores repetidos.
+ */
+TEST_F(AVLTreeTest, RandomOperationsKeepInvariants) {
+    std::mt19937 generator{42};
+    std::multiset<int> model;
+    for (auto i = 0; i < 4000; ++i) {
+        auto value = static_cast<int>(generator() % 500);
+        if (generator() % 3 != 0) {
+            int_list.insert(value);
+            model.insert(value);
+        } else if (!int_list.empty()) {
+            int_list.remove(value);
+            auto found = model.find(value);
+            if (found != model.end()) {
+                model.erase(found);
+            }
+        }
+        ASSERT_TRUE(int_list.valid());
+        ASSERT_EQ(model.size(), int_list.size());
+    }
+
+    auto expected = model.begin();
+    for (const auto& value : int_list) {
+        ASSERT_EQ(*expected, value);
+        ++expected;
+    }
+    // Limite de altura AVL: h < 1.4405 log2(n + 2).
+    ASSERT_LT(int_list.height(), 1.4405 * std::log2(model.size() + 2.0));
+}
+
+/**
+ * Testa a construção a partir de uma sequência ordenada.
+ */
+TEST_F(AVLTreeTest, FromSorted) {
+    auto values = std::vector<int>(1000);
+    for (auto i = 0u; i < values.size(); ++i) {
+        values[i] = static_cast<int>(i);
+    }
+    int_list = structures::AVLTree<int>::from_sorted(values.begin(),
+                                                     values.end());
+    ASSERT_EQ(values.size(), int_list.size());
+    ASSERT_TRUE(int_list.valid());
+    ASSERT_EQ(9, int_list.height());
+    contains_all(int_list, values);
+
+    int_list.insert(-1);
+    int_list.remove(500);
+    ASSERT_TRUE(int_list.valid());
+
+    ASSERT_THROW(structures::AVLTree<std::string>::from_sorted(
+                     string_values.begin(), string_values.end()),
+                 std::invalid_argument);
+}
+
+/**
+ * Testa a intercalação de duas árvores.
+ */
+TEST_F(AVLTreeTest, Merge) {
+    multiple_insertion(int_list, int_values);
+    auto other = structures::AVLTree<int>{};
+    for (auto i = 0; i < 100; ++i) {
+        other.insert(i * 3);
+    }
+
+    int_list.merge(std::move(other));
+    ASSERT_TRUE(other.empty());
+    ASSERT_EQ(int_values.size() + 100u, int_list.size());
+    ASSERT_TRUE(int_list.valid());
+    contains_all(int_list, int_values);
+    ASSERT_TRUE(int_list.contains(297));
+
+    other.merge(std::move(int_list));
+    ASSERT_TRUE(int_list.empty());
+    ASSERT_EQ(int_values.size() + 100u, other.size());
+    ASSERT_TRUE(other.valid());
+}
+
+/**
+ * Testa a intercalação de árvores de strings, cujos dados são movidos entre
+ * as arenas das duas árvores, e a remoção seguida de novas inserções, que
+ * reutilizam os nodos liberados.
+ */
+TEST_F(AVLTreeTest, MergeMovesStringsBetweenArenas) {
+    auto other = structures::AVLTree<std::string>{};
+    for (auto i = 0; i < 200; ++i) {
+        string_list.emplace(32u, static_cast<char>('a' + i % 26));
+        other.emplace(std::to_string(i));
+    }
+    for (auto i = 0; i < 100; ++i) {
+        other.remove(std::to_string(i));
+        other.insert(std::to_string(i) + "!");
+    }
+
+    string_list.merge(std::move(other));
+    ASSERT_TRUE(other.empty());
+    ASSERT_EQ(400u, string_list.size());
+    ASSERT_TRUE(string_list.valid());
+    ASSERT_TRUE(string_list.contains("99!"));
+    ASSERT_TRUE(string_list.contains("199"));
+    ASSERT_FALSE(string_list.contains("99"));
+    ASSERT_TRUE(string_list.contains(std::string(32u, 'z')));
+}
+
+/**
+ * Testa a intercalação quando a arena não consegue crescer: a falha pode
+ * ocorrer em qualquer alocação, e as duas árvores devem ficar intactas.
+ */
+TEST_F(AVLTreeTest, MergeFailingAllocationKeepsBothTrees) {
+    for (auto fail_at = 0; ; ++fail_at) {
+        auto tree = structures::AVLTree<std::string>{};
+        auto other = structures::AVLTree<std::string>{};
+        for (auto i = 0; i < 100; ++i) {
+            tree.insert(std::to_string(2 * i));
+        }
+        for (auto i = 0; i < 300; ++i) {
+            other.insert(std::to_string(2 * i + 1));
+        }
+
+        allocations_left = fail_at;
+        try {
+            tree.merge(std::move(other));
+        } catch (const std::bad_alloc&) {
+            allocations_left = -1;
+            ASSERT_EQ(100u, tree.size());
+            ASSERT_EQ(300u, other.size());
+            ASSERT_TRUE(tree.valid());
+            ASSERT_TRUE(other.valid());
+            ASSERT_TRUE(tree.contains("198"));
+            ASSERT_TRUE(other.contains("599"));
+            continue;
+        }
+        allocations_left = -1;
+        ASSERT_LT(0, fail_at);
+        ASSERT_TRUE(other.empty());
+        ASSERT_EQ(400u, tree.size());
+        ASSERT_TRUE(tree.valid());
+        ASSERT_TRUE(tree.contains("599"));
+        break;
+    }
+}
+
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
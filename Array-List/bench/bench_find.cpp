@@ -0,0 +1,66 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+#include "linear_find.h"
+
+// Compara scalar_find com linear_find (usada por ArrayList::find) para tipos
+// aritméticos, buscando o último elemento (hit) e um elemento ausente (miss).
+// Compilar com -mavx2 para medir o caminho AVX2 em vez do SSE2.
+
+namespace {
+const std::size_t TOTAL_ELEMENTS = 1u << 26;
+
+template <typename F>
+double ns_per_find(std::size_t size, F find) {
+  std::size_t repetitions = TOTAL_ELEMENTS / size;
+  std::size_t sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i != repetitions; i++) {
+    sink += find();
+  }
+  auto end = std::chrono::steady_clock::now();
+  std::chrono::duration<double, std::nano> elapsed = end - start;
+  if (sink == 1) {
+    std::printf("unreachable\n");
+  }
+  return elapsed.count() / repetitions;
+}
+
+template <typename T>
+void run(const char* type) {
+  for (std::size_t size = 16; size <= (1u << 20); size *= 16) {
+    T* contents = new T[size];
+    for (std::size_t i = 0; i != size; i++) {
+      contents[i] = static_cast<T>(i + 1);
+    }
+    const T hit = contents[size - 1];
+    const T miss = static_cast<T>(0);
+    const char* workloads[] = {"hit_end", "miss"};
+    const T keys[] = {hit, miss};
+    for (int w = 0; w != 2; w++) {
+      // volatile impede que o compilador trate a chave como constante.
+      volatile T key = keys[w];
+      double scalar = ns_per_find(size, [&] {
+        return structures::scalar_find(contents, size, T(key));
+      });
+      double vector = ns_per_find(size, [&] {
+        return structures::linear_find(contents, size, T(key));
+      });
+      std::printf("%-8s %-8s %-10zu %12.1f %12.1f %8.2fx\n", type,
+                  workloads[w], size, scalar, vector, scalar / vector);
+    }
+    delete[] contents;
+  }
+}
+}  // namespace
+
+int main(void) {
+  std::printf("%-8s %-8s %-10s %12s %12s %9s\n", "type", "workload", "size",
+              "scalar ns", "vector ns", "speedup");
+  run<int>("int32");
+  run<std::int64_t>("int64");
+  run<float>("float");
+  run<double>("double");
+  return 0;
+}
@@ -0,0 +1,96 @@
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "array_list.h"
+
+// Compara push_back em uma lista de tamanho fixo, dimensionada para o pior
+// caso, com uma lista expansível que parte da capacidade padrão. Cada
+// execução roda em um processo filho, e a coluna "peak KiB" é o pico de
+// memória residente dele (ru_maxrss, via wait4). A linha "baseline" é um
+// filho que não cria lista: o que passa dela é a memória da lista. Páginas
+// nunca tocadas da lista fixa não entram no pico.
+
+namespace {
+// Capacidade para a qual a lista fixa precisa ser dimensionada.
+const std::size_t WORST_CASE = 1u << 22;
+
+struct Result {
+  double ns_per_op;
+  long peak_kib;
+};
+
+//! Roda workload em um processo filho; retorna seu ns/op e pico de memória.
+template <typename F>
+Result in_child(F workload) {
+  int fds[2];
+  if (pipe(fds) != 0) {
+    std::perror("pipe");
+    std::exit(1);
+  }
+  pid_t pid = fork();
+  if (pid < 0) {
+    std::perror("fork");
+    std::exit(1);
+  }
+  if (pid == 0) {
+    close(fds[0]);
+    double ns_per_op = workload();
+    bool sent = write(fds[1], &ns_per_op, sizeof ns_per_op) ==
+                static_cast<ssize_t>(sizeof ns_per_op);
+    _exit(sent ? 0 : 1);
+  }
+  close(fds[1]);
+  Result result{0.0, 0};
+  if (read(fds[0], &result.ns_per_op, sizeof result.ns_per_op) !=
+      static_cast<ssize_t>(sizeof result.ns_per_op)) {
+    std::fprintf(stderr, "child produced no result\n");
+    std::exit(1);
+  }
+  close(fds[0]);
+  int status;
+  rusage usage{};
+  wait4(pid, &status, 0, &usage);
+  result.peak_kib = usage.ru_maxrss;
+  return result;
+}
+
+double push_back(std::size_t n, structures::ArrayList<int>& list) {
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i != n; i++) {
+    list.push_back(static_cast<int>(i));
+  }
+  auto end = std::chrono::steady_clock::now();
+  std::chrono::duration<double, std::nano> elapsed = end - start;
+  return elapsed.count() / n;
+}
+
+double fixed_push_back(std::size_t n) {
+  structures::ArrayList<int> list{WORST_CASE};
+  return push_back(n, list);
+}
+
+double growable_push_back(std::size_t n) {
+  structures::ArrayList<int> list{10u, true};
+  return push_back(n, list);
+}
+
+void print(const char* mode, std::size_t n, Result result) {
+  std::printf("%-10s %-10zu %12.2f %12ld\n", mode, n, result.ns_per_op,
+              result.peak_kib);
+}
+}  // namespace
+
+int main(void) {
+  std::printf("%-10s %-10s %12s %12s\n", "mode", "n", "ns/op", "peak KiB");
+  print("baseline", 0u, in_child([] { return 0.0; }));
+  for (std::size_t n = 1000; n <= WORST_CASE; n *= 8) {
+    print("fixed", n, in_child([n] { return fixed_push_back(n); }));
+    print("growable", n, in_child([n] { return growable_push_back(n); }));
+  }
+  return 0;
+}
@@ -0,0 +1,107 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "array_list.h"
+
+// Carga e esvaziamento de uma ArrayList<std::string> com strings maiores que
+// o buffer interno de std::string. Compara inserção por cópia, por movimento
+// e por construção (emplace_back), e remoção por cópia (at + pop) e por
+// movimento (pop). Conta as chamadas ao alocador substituindo o operator new
+// global.
+
+namespace {
+std::size_t allocations = 0;
+
+const std::size_t SIZE = 200000;
+}  // namespace
+
+void* operator new(std::size_t size) {
+  allocations++;
+  void* pointer = std::malloc(size == 0 ? 1 : size);
+  if (pointer == nullptr) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+void* operator new[](std::size_t size) { return operator new(size); }
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+
+void operator delete(void* pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+
+namespace {
+template <typename F>
+void run(const char* name, F operation) {
+  std::size_t before = allocations;
+  auto start = std::chrono::steady_clock::now();
+  operation();
+  auto end = std::chrono::steady_clock::now();
+  std::chrono::duration<double, std::nano> elapsed = end - start;
+  std::printf("%-12s %10.1f %14.2f\n", name, elapsed.count() / SIZE,
+              static_cast<double>(allocations - before) / SIZE);
+}
+
+std::vector<std::string> payloads(void) {
+  std::vector<std::string> strings;
+  strings.reserve(SIZE);
+  for (std::size_t i = 0; i != SIZE; i++) {
+    strings.push_back("payload-" + std::to_string(i) + "-xxxxxxxxxxxxxxxx");
+  }
+  return strings;
+}
+}  // namespace
+
+int main(void) {
+  const std::vector<std::string> source = payloads();
+  std::vector<std::string> movable = payloads();
+  structures::ArrayList<std::string> copied{SIZE};
+  structures::ArrayList<std::string> moved{SIZE};
+  structures::ArrayList<std::string> emplaced{SIZE};
+
+  std::printf("%-12s %10s %14s\n", "operation", "ns/op", "allocations/op");
+  run("push copy", [&] {
+    for (const auto& payload : source) {
+      copied.push_back(payload);
+    }
+  });
+  run("push move", [&] {
+    for (auto& payload : movable) {
+      moved.push_back(std::move(payload));
+    }
+  });
+  run("emplace", [&] {
+    for (const auto& payload : source) {
+      emplaced.emplace_back(payload.data(), payload.size());
+    }
+  });
+
+  std::size_t length = 0;
+  run("pop copy", [&] {
+    while (!copied.empty()) {
+      std::string payload = copied.at(copied.size() - 1);
+      copied.pop_back();
+      length += payload.size();
+    }
+  });
+  run("pop move", [&] {
+    while (!moved.empty()) {
+      std::string payload = moved.pop_back();
+      length += payload.size();
+    }
+  });
+  return length == 0;
+}
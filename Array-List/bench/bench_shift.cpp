@@ -0,0 +1,121 @@
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#include "array_list.h"
+
+// Mede inserção no início (push_front) e remoção do meio (pop) da ArrayList.
+// A coluna "loop" repete a mesma operação com o deslocamento elemento a
+// elemento por atribuição de cópia usado antes de relocate_overlapping.
+
+namespace {
+const std::size_t OPERATIONS = 256;
+
+template <typename T>
+void loop_move_backward(T* contents, std::size_t size, std::size_t index) {
+  for (std::size_t i = size; i != index; i--) {
+    contents[i] = contents[i - 1];
+  }
+}
+
+template <typename T>
+void loop_move_forward(T* contents, std::size_t size, std::size_t index) {
+  for (std::size_t i = index; i != size; i++) {
+    contents[i] = contents[i + 1];
+  }
+}
+
+template <typename F>
+double ns_per_op(F operation) {
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i != OPERATIONS; i++) {
+    operation();
+  }
+  auto end = std::chrono::steady_clock::now();
+  std::chrono::duration<double, std::nano> elapsed = end - start;
+  return elapsed.count() / OPERATIONS;
+}
+
+template <typename T>
+T value(std::size_t i);
+
+template <>
+int value<int>(std::size_t i) {
+  return static_cast<int>(i);
+}
+
+template <>
+std::string value<std::string>(std::size_t i) {
+  // Maior que o buffer interno de std::string, força alocação por cópia.
+  return "identifier-" + std::to_string(i) + "-xxxxxxxxxxxxxxxx";
+}
+
+template <typename T>
+double list_front_insert(std::size_t n) {
+  structures::ArrayList<T> list{n + OPERATIONS};
+  for (std::size_t i = 0; i != n; i++) {
+    list.push_back(value<T>(i));
+  }
+  T data = value<T>(0);
+  return ns_per_op([&] { list.push_front(data); });
+}
+
+template <typename T>
+double list_middle_pop(std::size_t n) {
+  structures::ArrayList<T> list{n};
+  for (std::size_t i = 0; i != n; i++) {
+    list.push_back(value<T>(i));
+  }
+  return ns_per_op([&list] { list.pop(list.size() / 2); });
+}
+
+template <typename T>
+double loop_front_insert(std::size_t n) {
+  T* contents = new T[n + OPERATIONS];
+  for (std::size_t i = 0; i != n; i++) {
+    contents[i] = value<T>(i);
+  }
+  std::size_t size = n;
+  T data = value<T>(0);
+  double result = ns_per_op([&] {
+    loop_move_backward(contents, size, 0);
+    contents[0] = data;
+    size++;
+  });
+  delete[] contents;
+  return result;
+}
+
+template <typename T>
+double loop_middle_pop(std::size_t n) {
+  T* contents = new T[n];
+  for (std::size_t i = 0; i != n; i++) {
+    contents[i] = value<T>(i);
+  }
+  std::size_t size = n;
+  double result = ns_per_op([&] {
+    size--;
+    loop_move_forward(contents, size, size / 2);
+  });
+  delete[] contents;
+  return result;
+}
+
+template <typename T>
+void run(const char* type, std::size_t max_n) {
+  for (std::size_t n = 1000; n <= max_n; n *= 10) {
+    std::printf("%-8s %-14s %-10zu %14.1f %14.1f\n", type, "front_insert", n,
+                loop_front_insert<T>(n), list_front_insert<T>(n));
+    std::printf("%-8s %-14s %-10zu %14.1f %14.1f\n", type, "middle_pop", n,
+                loop_middle_pop<T>(n), list_middle_pop<T>(n));
+  }
+}
+}  // namespace
+
+int main(void) {
+  std::printf("%-8s %-14s %-10s %14s %14s\n", "type", "operation", "n",
+              "loop ns/op", "bulk ns/op");
+  run<int>("int", 1000000);
+  run<std::string>("string", 100000);
+  return 0;
+}
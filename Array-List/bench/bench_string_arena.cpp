@@ -0,0 +1,83 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "string_list.h"
+
+// Carga em massa e busca (contains) na ArrayListString, comparando o modo
+// HEAP (uma alocação por string) com o modo ARENA. Conta as chamadas ao
+// alocador substituindo o operator new global.
+
+namespace {
+std::size_t allocations = 0;
+
+const std::size_t SIZE = 1000000;
+const std::size_t LOOKUPS = 20;
+}  // namespace
+
+void* operator new(std::size_t size) {
+  allocations++;
+  void* pointer = std::malloc(size == 0 ? 1 : size);
+  if (pointer == nullptr) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+void* operator new[](std::size_t size) { return operator new(size); }
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+
+void operator delete(void* pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+
+namespace {
+void run(const char* name, structures::ArrayListString::Storage storage,
+         const std::vector<std::string>& keys) {
+  auto start = std::chrono::steady_clock::now();
+  std::size_t before = allocations;
+  structures::ArrayListString list{keys.size(), false, storage};
+  for (const auto& key : keys) {
+    list.push_back(key.c_str());
+  }
+  std::size_t load_allocations = allocations - before;
+  auto loaded = std::chrono::steady_clock::now();
+
+  std::size_t found = 0;
+  for (std::size_t i = 0; i != LOOKUPS; i++) {
+    // Metade das buscas falha, percorrendo a lista inteira.
+    std::string key = i % 2 ? keys[keys.size() - 1 - i] : "missing";
+    found += list.contains(key.c_str());
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  std::chrono::duration<double, std::nano> load = loaded - start;
+  std::chrono::duration<double, std::milli> scan = end - loaded;
+  std::printf("%-8s %12.1f %14zu %16.2f %8zu\n", name, load.count() / SIZE,
+              load_allocations, scan.count() / LOOKUPS, found);
+}
+}  // namespace
+
+int main(void) {
+  std::vector<std::string> keys;
+  keys.reserve(SIZE);
+  for (std::size_t i = 0; i != SIZE; i++) {
+    keys.push_back("id_" + std::to_string(i));
+  }
+
+  std::printf("%-8s %12s %14s %16s %8s\n", "storage", "load ns/op",
+              "allocations", "contains ms/op", "found");
+  run("heap", structures::ArrayListString::HEAP, keys);
+  run("arena", structures::ArrayListString::ARENA, keys);
+  return 0;
+}
@@ -0,0 +1,77 @@
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "array_list.h"
+#include "string_list.h"
+
+// Mede contains sobre 1M identificadores curtos. "char*" reproduz o layout
+// anterior da ArrayListString: um vetor de ponteiros para strings alocadas
+// individualmente, comparadas com strcmp. "entry" é a ArrayListString atual,
+// com tamanho e prefixo guardados no próprio vetor.
+
+namespace {
+const std::size_t SIZE = 1000000;
+const std::size_t LOOKUPS = 20;
+
+bool pointer_contains(const structures::ArrayList<char*>& list,
+                      const char* data_ptr) {
+  for (std::size_t index = 0; index < list.size(); index++) {
+    if (strcmp(data_ptr, list.at(index)) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+std::string lookup_key(const std::vector<std::string>& keys, std::size_t i) {
+  // Metade das buscas falha, a outra metade acha um elemento no final.
+  return i % 2 ? keys[keys.size() - 1 - i] : "id_missing";
+}
+
+template <typename F>
+void run(const char* name, const std::vector<std::string>& keys, F contains) {
+  std::size_t found = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i != LOOKUPS; i++) {
+    found += contains(lookup_key(keys, i).c_str());
+  }
+  auto end = std::chrono::steady_clock::now();
+  std::chrono::duration<double, std::milli> elapsed = end - start;
+  std::printf("%-8s %16.2f %8zu\n", name, elapsed.count() / LOOKUPS, found);
+}
+}  // namespace
+
+int main(void) {
+  std::vector<std::string> keys;
+  keys.reserve(SIZE);
+  for (std::size_t i = 0; i != SIZE; i++) {
+    keys.push_back("id_" + std::to_string(i));
+  }
+
+  structures::ArrayList<char*> pointers{SIZE};
+  for (const auto& key : keys) {
+    char* copy = new char[key.size() + 1];
+    memcpy(copy, key.c_str(), key.size() + 1);
+    pointers.push_back(copy);
+  }
+  structures::ArrayListString entries{SIZE};
+  for (const auto& key : keys) {
+    entries.push_back(key.c_str());
+  }
+
+  std::printf("%-8s %16s %8s\n", "layout", "contains ms/op", "found");
+  run("char*", keys, [&pointers](const char* data_ptr) {
+    return pointer_contains(pointers, data_ptr);
+  });
+  run("entry", keys, [&entries](const char* data_ptr) {
+    return entries.contains(data_ptr);
+  });
+
+  for (std::size_t index = 0; index != pointers.size(); index++) {
+    delete[] pointers[index];
+  }
+  return 0;
+}
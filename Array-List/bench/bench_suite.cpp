@@ -0,0 +1,39 @@
+#include <numeric>
+#include <vector>
+
+#include "array_list.h"
+#include "benchmark.h"
+
+// Suíte de desempenho da ArrayList (ver benchmark::Suite). Para cada tamanho:
+// insert (push_back), lookup (contains de chaves aleatórias), traverse (uma
+// passada completa com iteradores por operação), insert_middle (insert na
+// metade da lista) e remove (pop_back). A capacidade comporta as inserções de
+// insert_middle além dos size elementos.
+
+int main(int argc, char* argv[]) {
+  benchmark::Suite suite{argc, argv};
+  for (auto size : suite.sizes()) {
+    structures::ArrayList<int> list{2 * size};
+    suite.measure("ArrayList", "insert", size, size,
+                  [&](std::size_t i) { list.push_back(static_cast<int>(i)); });
+
+    std::size_t lookups = suite.operations(size, benchmark::LINEAR);
+    std::vector<int> keys = benchmark::random_keys(lookups, size);
+    suite.measure("ArrayList", "lookup", size, lookups, [&](std::size_t i) {
+      benchmark::keep(list.contains(keys[i]));
+    });
+
+    suite.measure("ArrayList", "traverse", size, lookups, [&](std::size_t) {
+      benchmark::keep(std::accumulate(list.begin(), list.end(), 0L));
+    });
+
+    suite.measure("ArrayList", "insert_middle", size, lookups,
+                  [&](std::size_t i) {
+                    list.insert(static_cast<int>(i), list.size() / 2);
+                  });
+
+    suite.measure("ArrayList", "remove", size, size,
+                  [&](std::size_t) { benchmark::keep(list.pop_back()); });
+  }
+  return 0;
+}
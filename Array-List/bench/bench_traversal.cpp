@@ -0,0 +1,53 @@
+#include <chrono>
+#include <cstdio>
+#include <numeric>
+
+#include "array_list.h"
+
+// Soma todos os elementos da ArrayList por índice (at, com verificação de
+// limites) e por iteradores (range-for e std::accumulate).
+
+namespace {
+const std::size_t SIZE = 1u << 20;
+const std::size_t REPETITIONS = 100;
+
+template <typename F>
+void run(const char* name, F sum) {
+  long long total = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i != REPETITIONS; i++) {
+    total += sum();
+  }
+  auto end = std::chrono::steady_clock::now();
+  std::chrono::duration<double, std::nano> elapsed = end - start;
+  std::printf("%-12s %14.3f %20lld\n", name,
+              elapsed.count() / (REPETITIONS * SIZE), total);
+}
+}  // namespace
+
+int main(void) {
+  structures::ArrayList<int> list{SIZE};
+  for (std::size_t i = 0; i != SIZE; i++) {
+    list.push_back(static_cast<int>(i % 1000));
+  }
+
+  std::printf("%-12s %14s %20s\n", "traversal", "ns/element", "checksum");
+  run("at", [&list] {
+    long long sum = 0;
+    for (std::size_t i = 0; i != list.size(); i++) {
+      sum += list.at(i);
+    }
+    return sum;
+  });
+  run("range_for", [&list] {
+    long long sum = 0;
+    for (const auto& data : list) {
+      sum += data;
+    }
+    return sum;
+  });
+  run("accumulate", [&list] {
+    return std::accumulate(list.begin(), list.end(), 0LL);
+  });
+  return 0;
+}
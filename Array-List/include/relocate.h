@@ -0,0 +1,60 @@
+#ifndef STRUCTURES_RELOCATE_H_
+#define STRUCTURES_RELOCATE_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace structures {
+//! Função realoca
+/*!
+   Move count elementos de source para destination, que não podem se
+   sobrepor. Para tipos trivialmente copiáveis usa memcpy; para os demais usa
+   atribuição por movimento, deixando os elementos de source em estado válido
+   porém não especificado.
+
+   \param destination: Vetor de destino, com pelo menos count elementos (T*).
+   \param source: Vetor de origem (T*).
+   \param count: Quantidade de elementos a mover (size_t).
+ */
+template <typename T>
+void relocate(T* destination, T* source, std::size_t count) {
+  if constexpr (std::is_trivially_copyable<T>::value) {
+    if (count != 0) {
+      std::memcpy(destination, source, count * sizeof(T));
+    }
+  } else {
+    for (std::size_t i = 0; i != count; i++) {
+      destination[i] = std::move(source[i]);
+    }
+  }
+}
+
+//! Função realoca com sobreposição
+/*!
+   Move count elementos de source para destination dentro de um mesmo vetor,
+   permitindo que os intervalos se sobreponham. Para tipos trivialmente
+   copiáveis usa memmove; para os demais usa atribuição por movimento na
+   direção que preserva os elementos ainda não movidos.
+
+   \param destination: Início do intervalo de destino (T*).
+   \param source: Início do intervalo de origem (T*).
+   \param count: Quantidade de elementos a mover (size_t).
+ */
+template <typename T>
+void relocate_overlapping(T* destination, T* source, std::size_t count) {
+  if constexpr (std::is_trivially_copyable<T>::value) {
+    if (count != 0) {
+      std::memmove(destination, source, count * sizeof(T));
+    }
+  } else if (destination < source) {
+    std::move(source, source + count, destination);
+  } else {
+    std::move_backward(source, source + count, destination + count);
+  }
+}
+}  // namespace structures
+
+#endif
@@ -0,0 +1,120 @@
+#ifndef STRUCTURES_STRING_ARENA_H_
+#define STRUCTURES_STRING_ARENA_H_
+
+#include <cstdint>
+
+namespace structures {
+//! Classe StringArena
+/*!
+   Arena de strings. Copia strings para blocos grandes e contíguos de memória
+   por alocação sequencial ("bump allocation"). As strings não são liberadas
+   individualmente: toda a memória é liberada de uma só vez em clear() ou na
+   destruição da arena.
+ */
+class StringArena {
+ public:
+  //! Construtor padrão
+  /*!
+     Cria uma arena vazia que aloca blocos de tamanho padrão
+     (DEFAULT_CHUNK_SIZE). Nenhuma memória é alocada até a primeira cópia.
+   */
+  StringArena(void);
+
+  //! Construtor com parâmetro de tamanho de bloco
+  /*!
+     Cria uma arena vazia que aloca blocos de chunk_size bytes.
+
+     \param chunk_size: Tamanho de cada bloco, em bytes (size_t).
+   */
+  explicit StringArena(std::size_t chunk_size);
+
+  //! Destrutor
+  /*!
+     Libera todos os blocos da arena.
+   */
+  ~StringArena(void);
+
+  StringArena(const StringArena&) = delete;
+  StringArena& operator=(const StringArena&) = delete;
+
+  //! Método copia
+  /*!
+     Copia os length primeiros caracteres de data para a arena, terminando a
+     cópia com '\0'. Aloca um novo bloco apenas se o atual não tiver espaço.
+
+     \param data: Ponteiro constante para char (const char *).
+     \param length: Quantidade de caracteres a copiar (size_t).
+     \return Ponteiro para a cópia, válido até clear() ou a destruição da
+     arena (char *).
+   */
+  char* copy(const char* data, std::size_t length);
+
+  //! Método limpa
+  /*!
+     Invalida todas as cópias. Libera todos os blocos exceto o atual, que é
+     reaproveitado pelas próximas cópias.
+   */
+  void clear(void);
+
+  //! Método quantidade de blocos
+  /*!
+     Retorna a quantidade de blocos alocados pela arena.
+
+     \return Quantidade de blocos (size_t).
+   */
+  std::size_t chunks(void) const;
+
+ private:
+  //! Estrutura Chunk
+  /*!
+     Bloco de memória da arena. Os blocos formam uma lista encadeada, do mais
+     recente para o mais antigo.
+   */
+  struct Chunk {
+    char* data;
+    std::size_t size;
+    Chunk* next;
+  };
+
+  //! Método privado novo bloco
+  /*!
+     Aloca um bloco com pelo menos size bytes e o torna o bloco atual.
+
+     \param size: Tamanho mínimo do bloco (size_t).
+   */
+  void new_chunk(std::size_t size);
+
+  //! Bloco atual
+  /*!
+     Bloco onde são feitas as próximas cópias. nullptr se a arena estiver
+     vazia.
+   */
+  Chunk* head_;
+
+  //! Usado
+  /*!
+     Quantidade de bytes já ocupados no bloco atual.
+   */
+  std::size_t used_;
+
+  //! Tamanho do bloco
+  /*!
+     Tamanho dos blocos alocados pela arena.
+   */
+  std::size_t chunk_size_;
+
+  //! Quantidade de blocos
+  /*!
+     Quantidade de blocos na lista encadeada.
+   */
+  std::size_t chunks_;
+
+  //! Tamanho padrão do bloco
+  /*!
+     Tamanho de bloco usado pelo construtor padrão.
+   */
+  static const auto DEFAULT_CHUNK_SIZE = 64u * 1024u;
+};
+}  // namespace structures
+
+#endif
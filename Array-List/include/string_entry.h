@@ -0,0 +1,102 @@
+#ifndef STRUCTURES_STRING_ENTRY_H_
+#define STRUCTURES_STRING_ENTRY_H_
+
+#include <cstdint>
+#include <cstring>
+
+namespace structures {
+//! Estrutura StringEntry
+/*!
+   Elemento da ArrayListString. Guarda, junto do ponteiro para a string, o seu
+   tamanho e os seus primeiros PREFIX_SIZE caracteres (completados com '\0').
+   Assim as comparações decidem pelo tamanho e pelo prefixo sem seguir o
+   ponteiro, que só é acessado quando as strings são maiores que o prefixo e
+   os prefixos coincidem.
+ */
+struct StringEntry {
+  //! Tamanho do prefixo
+  /*!
+     Quantidade de caracteres guardados no próprio elemento. Escolhido para
+     que o elemento ocupe 24 bytes em plataformas de 64 bits.
+   */
+  static const auto PREFIX_SIZE = 12u;
+
+  //! Construtor padrão
+  /*!
+     Cria um elemento vazio, sem string associada.
+   */
+  StringEntry(void) : data{nullptr}, length{0u}, prefix{} {}
+
+  //! Construtor com string e tamanho
+  /*!
+     Cria um elemento que referencia data, sem copiá-la.
+
+     \param data: Ponteiro para a string (char *).
+     \param length: Tamanho da string, sem o '\0' (size_t).
+   */
+  StringEntry(char* data, std::size_t length) : data{data}, prefix{} {
+    // Tamanhos que não cabem em 32 bits saturam; strings de mesmo tamanho
+    // salvo são então comparadas por completo.
+    this->length = length > UINT32_MAX ? UINT32_MAX : length;
+    std::memcpy(prefix, data, length < PREFIX_SIZE ? length : PREFIX_SIZE);
+  }
+
+  //! String
+  /*!
+     Ponteiro para a string completa, terminada em '\0'.
+   */
+  char* data;
+
+  //! Tamanho
+  /*!
+     Tamanho da string, sem o '\0'.
+   */
+  std::uint32_t length;
+
+  //! Prefixo
+  /*!
+     Primeiros PREFIX_SIZE caracteres da string, completados com '\0'.
+   */
+  char prefix[PREFIX_SIZE];
+};
+
+//! Sobrecarga do operador ==
+/*!
+   Compara duas strings. Descarta pelo tamanho e pelo prefixo antes de acessar
+   o restante das strings.
+ */
+inline bool operator==(const StringEntry& lhs, const StringEntry& rhs) {
+  if (lhs.length != rhs.length ||
+      std::memcmp(lhs.prefix, rhs.prefix, StringEntry::PREFIX_SIZE) != 0) {
+    return false;
+  }
+  if (lhs.length <= StringEntry::PREFIX_SIZE) {
+    return true;
+  }
+  return std::strcmp(lhs.data + StringEntry::PREFIX_SIZE,
+                     rhs.data + StringEntry::PREFIX_SIZE) == 0;
+}
+
+//! Sobrecarga do operador <
+/*!
+   Ordem alfabética, equivalente a strcmp. Os prefixos completados com '\0'
+   ordenam como as strings; apenas quando são iguais e as strings os excedem
+   o restante é comparado.
+ */
+inline bool operator<(const StringEntry& lhs, const StringEntry& rhs) {
+  int prefix = std::memcmp(lhs.prefix, rhs.prefix, StringEntry::PREFIX_SIZE);
+  if (prefix != 0) {
+    return prefix < 0;
+  }
+  // Prefixos iguais: ou ambas as strings cabem no prefixo (e são iguais), ou
+  // ambas têm pelo menos PREFIX_SIZE caracteres.
+  if (lhs.length <= StringEntry::PREFIX_SIZE &&
+      rhs.length <= StringEntry::PREFIX_SIZE) {
+    return false;
+  }
+  return std::strcmp(lhs.data + StringEntry::PREFIX_SIZE,
+                     rhs.data + StringEntry::PREFIX_SIZE) < 0;
+}
+}  // namespace structures
+
+#endif
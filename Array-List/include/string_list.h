@@ -2,21 +2,41 @@
 #define STRUCTURES_STRING_LIST_H_
 
 #include "array_list.h"
+#include "string_arena.h"
+#include "string_entry.h"
 
 namespace structures {
 //! Classe ArrayListString
 /*!
    Classe lista de strings. Derivada da classe ArrayList. Os elementos dessa
-   classe são do tipo ponteiro para char.
+   classe são do tipo StringEntry, que guarda o ponteiro para char junto do
+   tamanho e do prefixo da string, de modo que find, contains e as buscas
+   ordenadas raramente precisam seguir o ponteiro. Os métodos de acesso
+   retornam o ponteiro para char.
+
+   A lista guarda uma cópia de cada string inserida. No modo HEAP (padrão),
+   cada cópia é alocada individualmente e o ponteiro retornado por pop passa a
+   pertencer a quem o chamou (liberar com delete[]). No modo ARENA, as cópias
+   ficam em uma StringArena e continuam válidas até clear() ou a destruição da
+   lista, inclusive as retornadas por pop.
  */
-class ArrayListString : public ArrayList<char *> {
+class ArrayListString : public ArrayList<StringEntry> {
  public:
+  //! Enumeração Storage
+  /*!
+     Modo de armazenamento das cópias das strings.
+   */
+  enum Storage {
+    HEAP,  /*!< Uma alocação por string. */
+    ARENA  /*!< Strings em blocos contíguos de uma StringArena. */
+  };
+
   //! Construtor padrão
   /*!
      Cria uma lista de ponteiros para char, usando o atributo de tamanho padrão
      como tamanho máximo da lista.
    */
-  ArrayListString(void) : ArrayList() {}
+  ArrayListString(void) : ArrayList(), storage_{HEAP} {}
 
   //! Construtor com parâmetro de tamanho máximo
   /*!
@@ -25,7 +45,31 @@ class ArrayListString : public ArrayList<char *> {
 
      \param max_size: Tamanho máximo da lista (size_t).
    */
-  explicit ArrayListString(std::size_t max_size) : ArrayList(max_size) {}
+  explicit ArrayListString(std::size_t max_size)
+      : ArrayList(max_size), storage_{HEAP} {}
+
+  //! Construtor com parâmetros de tamanho máximo e crescimento
+  /*!
+     Cria uma lista de ponteiros para char com capacidade inicial max_size. Se
+     growable for verdadeiro, a lista cresce automaticamente quando cheia.
+
+     \param max_size: Capacidade inicial da lista (size_t).
+     \param growable: Habilita o crescimento automático (bool).
+   */
+  ArrayListString(std::size_t max_size, bool growable)
+      : ArrayList(max_size, growable), storage_{HEAP} {}
+
+  //! Construtor com parâmetros de tamanho máximo, crescimento e armazenamento
+  /*!
+     Cria uma lista de ponteiros para char com capacidade inicial max_size,
+     guardando as cópias das strings no modo storage.
+
+     \param max_size: Capacidade inicial da lista (size_t).
+     \param growable: Habilita o crescimento automático (bool).
+     \param storage: Modo de armazenamento das strings (Storage).
+   */
+  ArrayListString(std::size_t max_size, bool growable, Storage storage)
+      : ArrayList(max_size, growable), storage_{storage} {}
 
   //! Destrutor
   /*!
@@ -33,6 +77,21 @@ class ArrayListString : public ArrayList<char *> {
    */
   ~ArrayListString(void);
 
+  //! Método limpa
+  /*!
+     Limpa a lista e libera as cópias das strings. No modo ARENA, libera os
+     blocos da arena de uma só vez.
+   */
+  void clear(void);
+
+  //! Método armazenamento
+  /*!
+     Getter do atributo storage_, retorna o modo de armazenamento das strings.
+
+     \return Modo de armazenamento (Storage).
+   */
+  Storage storage(void) const;
+
   //! Método adiciona no fim
   /*!
      Adiciona elemento (data_ptr) no fim da lista, se houver espaço. Caso não há
@@ -66,7 +125,8 @@ class ArrayListString : public ArrayList<char *> {
   //! Método insere em ordem
   /*!
      Insere elemento (data_ptr) em ordem (alfabética) na lista, caso a lista
-     tenha espaço. Se não houver espaço lança exceção (out_of_range).
+     tenha espaço. A posição é achada por busca binária (lower_bound). Se não
+     houver espaço lança exceção (out_of_range).
 
      \param data_ptr: Ponteiro constante para char (const char *).
    */
@@ -104,12 +164,119 @@ class ArrayListString : public ArrayList<char *> {
    */
   std::size_t find(const char *data_ptr) const;
 
+  //! Método limite inferior
+  /*!
+     Busca binária pela primeira posição cuja string não é menor (strcmp) que
+     data_ptr. Requer que a lista esteja em ordem alfabética.
+
+     \param data_ptr: Ponteiro constante para char (const char *).
+     \return Posição da primeira string não menor que data_ptr, ou tamanho da
+     lista (size_t).
+   */
+  std::size_t lower_bound(const char *data_ptr) const;
+
+  //! Método limite superior
+  /*!
+     Busca binária pela primeira posição cuja string é maior (strcmp) que
+     data_ptr. Requer que a lista esteja em ordem alfabética.
+
+     \param data_ptr: Ponteiro constante para char (const char *).
+     \return Posição da primeira string maior que data_ptr, ou tamanho da
+     lista (size_t).
+   */
+  std::size_t upper_bound(const char *data_ptr) const;
+
+  //! Método achar ordenado
+  /*!
+     Acha a posição do elemento (data_ptr) por busca binária. Requer que a
+     lista esteja em ordem alfabética. Se o elemento não estiver presente,
+     retorna o tamanho da lista. Se a lista estiver vazia, lança exceção
+     (out_of_range).
+
+     \param data_ptr: Ponteiro constante para char (const char *).
+     \return índice do elemento (size_t), ou tamanho da lista.
+   */
+  std::size_t find_sorted(const char *data_ptr) const;
+
+  //! Método remove da posição
+  /*!
+     Remove elemento na posição passada (index), se houver elementos e se a
+     posição for válida. Se não há elementos ou a posição não é válida, lança
+     exceção (out_of_range).
+
+     \param index: Posição do elemento a ser removido (size_t).
+     \return Ponteiro para a string removida (char *).
+   */
+  char *pop(std::size_t index);
+
+  //! Método remove do final
+  /*!
+     Remove elemento no final da lista. Se a lista estiver vazia, lança
+     exceção (out_of_range).
+
+     \return Ponteiro para a string removida (char *).
+   */
+  char *pop_back(void);
+
+  //! Método remove do início
+  /*!
+     Remove elemento no início da lista. Se a lista estiver vazia, lança
+     exceção (out_of_range).
+
+     \return Ponteiro para a string removida (char *).
+   */
+  char *pop_front(void);
+
+  //! Método "em"
+  /*!
+     Retorna a string na posição (index). Caso o índice seja inválido lança
+     exceção (out_of_range).
+
+     \param index: Posição do elemento a ser retornado (size_t).
+     \return Ponteiro para a string na posição (char *).
+   */
+  char *at(std::size_t index) const;
+
+  //! Sobrecarga do operador []
+  /*!
+     Retorna a string na posição (index). Caso o índice seja inválido lança
+     exceção (out_of_range).
+
+     \param index: Posição do elemento a ser retornado (size_t).
+     \return Ponteiro para a string na posição (char *).
+   */
+  char *operator[](std::size_t index) const;
+
  private:
   //! Método aloca ponteiro data
   /*!
-     Aloca memória e copia conteúdo de data_ptr
+     Aloca memória e copia conteúdo de data_ptr, no heap ou na arena conforme
+     o modo de armazenamento.
+
+     \return Elemento que referencia a cópia (StringEntry).
+   */
+  StringEntry alloc_data_ptr(const char *data_ptr);
+
+  //! Método chave
+  /*!
+     Cria um elemento que referencia data_ptr sem copiá-la, para ser usado
+     nas buscas.
+
+     \return Elemento que referencia data_ptr (StringEntry).
+   */
+  static StringEntry key(const char *data_ptr);
+
+  //! Armazenamento
+  /*!
+     Modo de armazenamento das cópias das strings.
+   */
+  Storage storage_;
+
+  //! Arena
+  /*!
+     Arena que guarda as cópias das strings no modo ARENA.
    */
-  char *alloc_data_ptr(const char *data_ptr);
+  StringArena arena_;
 };
 }  // namespace structures
 
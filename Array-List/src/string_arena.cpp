@@ -0,0 +1,63 @@
+#include "string_arena.h"
+
+#include <cstring>
+
+structures::StringArena::StringArena(void) {
+  head_ = nullptr;
+  used_ = 0u;
+  chunk_size_ = DEFAULT_CHUNK_SIZE;
+  chunks_ = 0u;
+}
+
+structures::StringArena::StringArena(std::size_t chunk_size) {
+  head_ = nullptr;
+  used_ = 0u;
+  chunk_size_ = chunk_size;
+  chunks_ = 0u;
+}
+
+structures::StringArena::~StringArena(void) {
+  while (head_ != nullptr) {
+    Chunk* out = head_;
+    head_ = head_->next;
+    delete[] out->data;
+    delete out;
+  }
+}
+
+char* structures::StringArena::copy(const char* data, std::size_t length) {
+  if (head_ == nullptr || head_->size - used_ < length + 1) {
+    new_chunk(length + 1 > chunk_size_ ? length + 1 : chunk_size_);
+  }
+  char* destination = head_->data + used_;
+  std::memcpy(destination, data, length);
+  destination[length] = '\0';
+  used_ += length + 1;
+  return destination;
+}
+
+void structures::StringArena::clear(void) {
+  if (head_ == nullptr) {
+    return;
+  }
+  Chunk* next = head_->next;
+  while (next != nullptr) {
+    Chunk* out = next;
+    next = next->next;
+    delete[] out->data;
+    delete out;
+  }
+  head_->next = nullptr;
+  used_ = 0u;
+  chunks_ = 1u;
+}
+
+std::size_t structures::StringArena::chunks(void) const {
+  return chunks_;
+}
+
+void structures::StringArena::new_chunk(std::size_t size) {
+  head_ = new Chunk{new char[size], size, head_};
+  used_ = 0u;
+  chunks_++;
+}
@@ -2,11 +2,29 @@
 #include "string_list.h"
 
 structures::ArrayListString::~ArrayListString(void) {
-  for (auto index = 0; index != size(); index++) {
-    delete at(index);
+  if (storage_ == HEAP) {
+    for (std::size_t index = 0; index != size(); index++) {
+      delete[] at(index);
+    }
   }
 }
 
+void structures::ArrayListString::clear(void) {
+  if (storage_ == HEAP) {
+    for (std::size_t index = 0; index != size(); index++) {
+      delete[] at(index);
+    }
+  } else {
+    arena_.clear();
+  }
+  ArrayList::clear();
+}
+
+structures::ArrayListString::Storage structures::ArrayListString::storage(
+    void) const {
+  return storage_;
+}
+
 void structures::ArrayListString::push_back(const char * data_ptr) {
   ArrayList::push_back(alloc_data_ptr(data_ptr));
 }
@@ -20,18 +38,11 @@ void structures::ArrayListString::insert(const char * data_ptr, std::size_t inde
 }
 
 void structures::ArrayListString::insert_sorted(const char * data_ptr) {
-  if (full()) {
+  if (full() && !growable()) {
     throw(std::out_of_range("Cannot insert in full list"));
-  } else if (empty()) {
-    push_back(data_ptr);
   } else {
-    std::size_t index = 0;
-    while (index <= size() - 1 && strcmp(data_ptr, at(index)) > 0){
-      index++;
-    }
-    insert(data_ptr, index);
+    insert(data_ptr, lower_bound(data_ptr));
   }
-
 }
 
 void structures::ArrayListString::remove(const char * data_ptr) {
@@ -41,6 +52,8 @@ void structures::ArrayListString::remove(const char * data_ptr) {
     std::size_t index = find(data_ptr);
     if (index == size()) {
       throw(std::invalid_argument("List does not contain the argument"));
+    } else if (storage_ == HEAP) {
+      delete[] pop(index);
     } else {
       pop(index);
     }
@@ -51,29 +64,65 @@ std::size_t structures::ArrayListString::find(const char * data_ptr) const {
   if (empty()) {
     throw(std::out_of_range("Cannot find an element on an empty list"));
   }
-  std::size_t index = 0;
-  while (index <= size() - 1 && !(strcmp(data_ptr, at(index)) == 0)) {
-    index++;
-  }
-  if (index > size() - 1) {
-    return size();
-  } else {
-    return index;
+  return ArrayList::find(key(data_ptr));
+}
+
+std::size_t structures::ArrayListString::lower_bound(
+    const char * data_ptr) const {
+  return ArrayList::lower_bound(key(data_ptr));
+}
+
+std::size_t structures::ArrayListString::upper_bound(
+    const char * data_ptr) const {
+  return ArrayList::upper_bound(key(data_ptr));
+}
+
+std::size_t structures::ArrayListString::find_sorted(
+    const char * data_ptr) const {
+  if (empty()) {
+    throw(std::out_of_range("Cannot find an element on an empty list"));
   }
+  return ArrayList::find_sorted(key(data_ptr));
 }
 
 bool structures::ArrayListString::contains(const char * data_ptr) const {
-  for (std::size_t index = 0; index < size(); index++) {
-    if (strcmp(data_ptr, at(index)) == 0) {
-      return true;
-    }
-  }
-  return false;
+  return !empty() && ArrayList::contains(key(data_ptr));
+}
+
+char * structures::ArrayListString::pop(std::size_t index) {
+  return ArrayList::pop(index).data;
+}
+
+char * structures::ArrayListString::pop_back(void) {
+  return ArrayList::pop_back().data;
+}
+
+char * structures::ArrayListString::pop_front(void) {
+  return ArrayList::pop_front().data;
+}
+
+char * structures::ArrayListString::at(std::size_t index) const {
+  return ArrayList::at(index).data;
+}
+
+char * structures::ArrayListString::operator[](std::size_t index) const {
+  return ArrayList::at(index).data;
 }
 
-char * structures::ArrayListString::alloc_data_ptr(const char * data_ptr) {
-  char * new_data_ptr = new char[strlen(data_ptr) + 1];
-  snprintf(new_data_ptr, strlen(data_ptr)+1, "%s", data_ptr);
+structures::StringEntry structures::ArrayListString::alloc_data_ptr(
+    const char * data_ptr) {
+  std::size_t length = strlen(data_ptr);
+  if (storage_ == ARENA) {
+    return StringEntry(arena_.copy(data_ptr, length), length);
+  }
+
+  char * new_data_ptr = new char[length + 1];
+  memcpy(new_data_ptr, data_ptr, length + 1);
+
+  return StringEntry(new_data_ptr, length);
+}
 
-  return new_data_ptr;
+structures::StringEntry structures::ArrayListString::key(
+    const char * data_ptr) {
+  return StringEntry(const_cast<char *>(data_ptr), strlen(data_ptr));
 }
@@ -1,8 +1,17 @@
 #include <stdio.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
 #include <stdexcept>
+#include <string>
+#include <utility>
 
 #include "array_list.h"
+#include "linear_find.h"
+#include "string_arena.h"
+#include "string_entry.h"
 #include "string_list.h"
 #include "gtest/gtest.h"
 
@@ -19,7 +28,7 @@ class ArrayListTest : public ::testing::Test {
   structures::ArrayList<int> default_list{};
 
   void push_back_fill(void) {
-    for (auto i = 0; i < list.max_size(); i++) {
+    for (std::size_t i = 0; i < list.max_size(); i++) {
       list.push_back(i);
     }
   }
@@ -85,7 +94,7 @@ TEST_F(ArrayListTest, PushBackThrowsErrorWhenFull) {
 
 TEST_F(ArrayListTest, PushBackAddDataToEndOfList) {
   push_back_fill();
-  for (auto i = 0; i < list.max_size(); i++) {
+  for (std::size_t i = 0; i < list.max_size(); i++) {
     ASSERT_EQ(i, list[i]);
   }
 }
@@ -122,13 +131,13 @@ TEST_F(ArrayListTest, PushFrontMovesBackwards) {
   push_back_fill();
   list.pop_back();
   list.push_front(666);
-  for (auto i = 0; i < list.max_size() - 1; i++) {
+  for (std::size_t i = 0; i < list.max_size() - 1; i++) {
     ASSERT_EQ(i, list[i + 1]);
   }
 }
 
 TEST_F(ArrayListTest, PushFrontInsertsDataInAtIndex0) {
-  for (auto i = 0; i < list.max_size(); i++) {
+  for (std::size_t i = 0; i < list.max_size(); i++) {
     list.push_front(i);
     ASSERT_EQ(i, list[0]);
   }
@@ -147,7 +156,7 @@ TEST_F(ArrayListTest, PopFrontThrowsErrorWhenEmpty) {
 
 TEST_F(ArrayListTest, PopFrontRemovesFrontElement) {
   push_back_fill();
-  for (auto i = 0; i < list.max_size(); i++) {
+  for (std::size_t i = 0; i < list.max_size(); i++) {
     ASSERT_EQ(i, list.pop_front());
   }
 }
@@ -163,7 +172,7 @@ TEST_F(ArrayListTest, InsertThrowsErrorWhenInvalidIndex) {
 }
 
 TEST_F(ArrayListTest, InsertsAtTheRightPlace) {
-  for (auto i = 0; i < list.max_size() - 1; i++) {
+  for (std::size_t i = 0; i < list.max_size() - 1; i++) {
     list.push_back(i);
   }
 
@@ -197,7 +206,7 @@ TEST_F(ArrayListTest, InsertSortedThrowsErrorWhenFull) {
 }
 
 TEST_F(ArrayListTest, InsertInOrderIncreasesSize) {
-  for (auto i = 0; i < list.max_size(); i++) {
+  for (std::size_t i = 0; i < list.max_size(); i++) {
     list.insert_sorted(i);
     ASSERT_EQ(i + 1, list.size());
   }
@@ -208,7 +217,7 @@ TEST_F(ArrayListTest, InsertInOrder) {
     list.insert_sorted(i);
   }
 
-  for (auto i = 0; i < list.max_size(); ++i) {
+  for (std::size_t i = 0; i < list.max_size(); ++i) {
     ASSERT_EQ(i, list[i]);
   }
 
@@ -226,7 +235,7 @@ TEST_F(ArrayListTest, InsertInOrder) {
 
 TEST_F(ArrayListTest, ContainsReturnsTrueWhenContainsData) {
   push_back_fill();
-  for (auto i = 0; i < list.max_size(); i++) {
+  for (std::size_t i = 0; i < list.max_size(); i++) {
     ASSERT_TRUE(list.contains(i));
   }
 }
@@ -245,7 +254,7 @@ TEST_F(ArrayListTest, FindReturnsSizeWhenElementNotFound) {
 
 TEST_F(ArrayListTest, FindReturnsTheIndexOfData) {
   push_back_fill();
-  for (auto i = 0; i < list.max_size(); i++) {
+  for (std::size_t i = 0; i < list.max_size(); i++) {
     ASSERT_EQ(i, list.find(i));
   }
 }
@@ -282,16 +291,288 @@ TEST_F(ArrayListTest, AccessOnNegativeIndex) {
 }
 
 TEST_F(ArrayListTest, IndexAccess) {
-  for (auto i = 0; i < list.max_size(); i++) {
+  for (std::size_t i = 0; i < list.max_size(); i++) {
     list.push_back(i);
   }
 
-  for (auto i = 0; i < list.max_size(); i++) {
+  for (std::size_t i = 0; i < list.max_size(); i++) {
     ASSERT_EQ(list.at(i), i);
     ASSERT_EQ(list[i], i);
   }
 }
 
+TEST_F(ArrayListTest, LowerBoundReturnsFirstNotLessPosition) {
+  for (auto i = 0; i < 10; i++) {
+    list.push_back(2 * i);
+  }
+  ASSERT_EQ(0, list.lower_bound(-1));
+  ASSERT_EQ(0, list.lower_bound(0));
+  ASSERT_EQ(3, list.lower_bound(5));
+  ASSERT_EQ(3, list.lower_bound(6));
+  ASSERT_EQ(10, list.lower_bound(100));
+}
+
+TEST_F(ArrayListTest, UpperBoundReturnsFirstGreaterPosition) {
+  for (auto i = 0; i < 10; i++) {
+    list.push_back(i / 2);
+  }
+  ASSERT_EQ(0, list.upper_bound(-1));
+  ASSERT_EQ(2, list.upper_bound(0));
+  ASSERT_EQ(6, list.upper_bound(2));
+  ASSERT_EQ(10, list.upper_bound(4));
+}
+
+TEST_F(ArrayListTest, BoundsOnEmptyListReturnZero) {
+  ASSERT_EQ(0, list.lower_bound(1));
+  ASSERT_EQ(0, list.upper_bound(1));
+}
+
+TEST_F(ArrayListTest, FindSortedThrowsErrorWhenEmpty) {
+  ASSERT_THROW(list.find_sorted(1), std::out_of_range);
+}
+
+TEST_F(ArrayListTest, FindSortedReturnsTheIndexOfData) {
+  push_back_fill();
+  for (std::size_t i = 0; i < list.max_size(); i++) {
+    ASSERT_EQ(i, list.find_sorted(i));
+  }
+}
+
+TEST_F(ArrayListTest, FindSortedReturnsSizeWhenElementNotFound) {
+  for (auto i = 0; i < 10; i++) {
+    list.push_back(2 * i);
+  }
+  ASSERT_EQ(list.size(), list.find_sorted(-1));
+  ASSERT_EQ(list.size(), list.find_sorted(7));
+  ASSERT_EQ(list.size(), list.find_sorted(100));
+}
+
+TEST_F(ArrayListTest, InsertSortedKeepsOrderWithDuplicates) {
+  const int values[] = {5, 3, 5, 1, 3, 9, 0, 5};
+  for (auto value : values) {
+    list.insert_sorted(value);
+  }
+  for (auto i = 1u; i < list.size(); i++) {
+    ASSERT_LE(list[i - 1], list[i]);
+  }
+  ASSERT_EQ(4, list.find_sorted(5));
+}
+
+TEST_F(ArrayListTest, BeginEqualsEndWhenEmpty) {
+  ASSERT_EQ(list.begin(), list.end());
+  ASSERT_EQ(list.cbegin(), list.cend());
+}
+
+TEST_F(ArrayListTest, RangeForVisitsElementsInOrder) {
+  push_back_fill();
+  auto expected = 0;
+  for (auto& data : list) {
+    ASSERT_EQ(expected++, data);
+  }
+  ASSERT_EQ(20, expected);
+}
+
+TEST_F(ArrayListTest, IteratorsWorkWithStandardAlgorithms) {
+  for (auto i = 19; i >= 0; i--) {
+    list.push_back(i);
+  }
+  std::sort(list.begin(), list.end());
+  for (auto i = 0; i < 20; i++) {
+    ASSERT_EQ(i, list[i]);
+  }
+  ASSERT_EQ(190, std::accumulate(list.cbegin(), list.cend(), 0));
+  ASSERT_EQ(20, list.end() - list.begin());
+}
+
+TEST_F(ArrayListTest, IteratorsAllowModification) {
+  push_back_fill();
+  for (auto& data : list) {
+    data *= 2;
+  }
+  ASSERT_EQ(38, list[19]);
+}
+
+TEST_F(ArrayListTest, ConstIteratorsOnConstList) {
+  push_back_fill();
+  const structures::ArrayList<int>& const_list = list;
+  ASSERT_EQ(190, std::accumulate(const_list.begin(), const_list.end(), 0));
+}
+
+TEST_F(ArrayListTest, DataPointsToContiguousElements) {
+  push_back_fill();
+  int* data = list.data();
+  ASSERT_EQ(data, &list[0]);
+  for (auto i = 0; i < 20; i++) {
+    ASSERT_EQ(i, data[i]);
+  }
+}
+
+TEST_F(ArrayListTest, MoveConstructorTakesElements) {
+  push_back_fill();
+  structures::ArrayList<int> moved{std::move(list)};
+  ASSERT_EQ(20, moved.size());
+  ASSERT_EQ(20, moved.max_size());
+  ASSERT_EQ(19, moved.at(19));
+  ASSERT_TRUE(list.empty());
+  ASSERT_EQ(0, list.max_size());
+}
+
+TEST_F(ArrayListTest, MoveAssignmentReplacesElements) {
+  push_back_fill();
+  default_list.push_back(-1);
+  default_list = std::move(list);
+  ASSERT_EQ(20, default_list.size());
+  ASSERT_EQ(0, default_list.at(0));
+  ASSERT_TRUE(list.empty());
+}
+
+TEST_F(ArrayListTest, PushRvalueMovesStrings) {
+  structures::ArrayList<std::string> strings{4};
+  std::string back(64, 'b');
+  std::string front(64, 'f');
+  strings.push_back(std::move(back));
+  strings.push_front(std::move(front));
+  strings.insert(std::string(64, 'i'), 1);
+  ASSERT_TRUE(back.empty());
+  ASSERT_TRUE(front.empty());
+  ASSERT_EQ(std::string(64, 'f'), strings.at(0));
+  ASSERT_EQ(std::string(64, 'i'), strings.at(1));
+  ASSERT_EQ(std::string(64, 'b'), strings.at(2));
+}
+
+TEST_F(ArrayListTest, EmplaceConstructsFromArguments) {
+  structures::ArrayList<std::string> strings{4};
+  ASSERT_EQ("bbb", strings.emplace_back(3u, 'b'));
+  ASSERT_EQ("a", strings.emplace_front("a"));
+  strings.emplace(1, 2u, 'x') += "y";
+  ASSERT_EQ(3, strings.size());
+  ASSERT_EQ("xxy", strings.at(1));
+  ASSERT_THROW(strings.emplace(5, "z"), std::out_of_range);
+  strings.emplace_back();
+  ASSERT_THROW(strings.emplace_back("z"), std::out_of_range);
+  ASSERT_EQ(4, strings.size());
+}
+
+TEST_F(ArrayListTest, PopMovesElementOut) {
+  structures::ArrayList<std::string> strings{4};
+  strings.push_back(std::string(64, 'a'));
+  strings.push_back(std::string(64, 'b'));
+  strings.push_back(std::string(64, 'c'));
+  ASSERT_EQ(std::string(64, 'b'), strings.pop(1));
+  ASSERT_EQ(std::string(64, 'c'), strings.pop_back());
+  ASSERT_EQ(std::string(64, 'a'), strings.pop_front());
+  ASSERT_TRUE(strings.empty());
+}
+
+TEST_F(ArrayListTest, ConstructorDefaultsToFixedSize) {
+  ASSERT_FALSE(list.growable());
+  ASSERT_FALSE(default_list.growable());
+}
+
+TEST_F(ArrayListTest, GrowableListGrowsWhenFull) {
+  structures::ArrayList<int> growable{2, true};
+  for (auto i = 0; i < 100; i++) {
+    growable.push_back(i);
+  }
+  ASSERT_EQ(100, growable.size());
+  ASSERT_GE(growable.max_size(), 100);
+  for (auto i = 0; i < 100; i++) {
+    ASSERT_EQ(i, growable[i]);
+  }
+}
+
+TEST_F(ArrayListTest, GrowableListGrowsGeometrically) {
+  structures::ArrayList<int> growable{4, true};
+  for (auto i = 0; i < 5; i++) {
+    growable.push_back(i);
+  }
+  ASSERT_EQ(8, growable.max_size());
+}
+
+TEST_F(ArrayListTest, GrowableListGrowsOnEveryInsertion) {
+  structures::ArrayList<int> growable{1, true};
+  growable.push_back(2);
+  growable.push_front(0);
+  growable.insert(1, 1);
+  growable.insert_sorted(3);
+  ASSERT_EQ(4, growable.size());
+  for (auto i = 0; i < 4; i++) {
+    ASSERT_EQ(i, growable[i]);
+  }
+}
+
+TEST_F(ArrayListTest, ReserveIncreasesMaxSizeAndKeepsElements) {
+  push_back_fill();
+  list.reserve(50);
+  ASSERT_EQ(50, list.max_size());
+  ASSERT_EQ(20, list.size());
+  for (auto i = 0; i < 20; i++) {
+    ASSERT_EQ(i, list[i]);
+  }
+  list.push_back(20);
+  ASSERT_EQ(20, list[20]);
+}
+
+TEST_F(ArrayListTest, ReserveNeverShrinks) {
+  list.reserve(5);
+  ASSERT_EQ(20, list.max_size());
+}
+
+TEST_F(ArrayListTest, ShrinkToFitReducesMaxSizeToSize) {
+  for (auto i = 0; i < 5; i++) {
+    list.push_back(i);
+  }
+  list.shrink_to_fit();
+  ASSERT_EQ(5, list.max_size());
+  ASSERT_TRUE(list.full());
+  for (auto i = 0; i < 5; i++) {
+    ASSERT_EQ(i, list[i]);
+  }
+}
+
+TEST_F(ArrayListTest, GrowableListGrowsAfterShrinkingToZero) {
+  structures::ArrayList<int> growable{4, true};
+  growable.shrink_to_fit();
+  ASSERT_EQ(0, growable.max_size());
+  growable.push_back(1);
+  ASSERT_EQ(1, growable[0]);
+}
+
+TEST_F(ArrayListTest, InsertingOwnElementSurvivesGrowth) {
+  structures::ArrayList<std::string> strings{2u, true};
+  strings.push_back(std::string(40, 'a'));
+  strings.push_back(std::string(40, 'b'));
+  strings.push_back(strings[0]);
+  strings.push_front(strings[1]);
+  strings.insert(strings[3], 2);
+
+  const std::string a(40, 'a');
+  const std::string b(40, 'b');
+  ASSERT_EQ(5u, strings.size());
+  ASSERT_EQ(b, strings[0]);
+  ASSERT_EQ(a, strings[1]);
+  ASSERT_EQ(a, strings[2]);
+  ASSERT_EQ(b, strings[3]);
+  ASSERT_EQ(a, strings[4]);
+
+  structures::ArrayList<std::string> sorted{2u, true};
+  sorted.push_back(a);
+  sorted.push_back(b);
+  sorted.insert_sorted(sorted[1]);
+  ASSERT_EQ(3u, sorted.size());
+  ASSERT_EQ(b, sorted[1]);
+  ASSERT_EQ(b, sorted[2]);
+}
+
+TEST_F(ArrayListTest, InvalidInsertDoesNotGrow) {
+  structures::ArrayList<int> growable{2u, true};
+  growable.push_back(0);
+  growable.push_back(1);
+  ASSERT_THROW(growable.insert(2, 3), std::out_of_range);
+  ASSERT_EQ(2u, growable.max_size());
+  ASSERT_EQ(2u, growable.size());
+}
+
 class ArrayListStringTest : public ::testing::Test {
  protected:
   structures::ArrayListString default_list{};
@@ -301,13 +582,13 @@ class ArrayListStringTest : public ::testing::Test {
                              "Java",      "Javascript", "Python", "Go", "Lua"};
 
   void push_back_fill(const char* arr[]) {
-    for (auto i = 0; i < list.max_size(); i++) {
+    for (std::size_t i = 0; i < list.max_size(); i++) {
       list.push_back(arr[i]);
     }
   }
 
   void push_front_fill(const char* arr[]) {
-    for (auto i = 0; i < list.max_size(); i++) {
+    for (std::size_t i = 0; i < list.max_size(); i++) {
       list.push_front(arr[i]);
     }
   }
@@ -362,7 +643,7 @@ TEST_F(ArrayListStringTest, PushFrontIncreasesSize) {
 }
 
 TEST_F(ArrayListStringTest, PushFrontInsertsDataInAtIndex0) {
-  for (auto i = 0; i < list.max_size(); i++) {
+  for (std::size_t i = 0; i < list.max_size(); i++) {
     list.push_front(content[i]);
     ASSERT_STREQ(list[0], content[i]);
   }
@@ -389,7 +670,7 @@ TEST_F(ArrayListStringTest, InsertThrowsErrorWhenInvalidIndex) {
 }
 
 TEST_F(ArrayListStringTest, InsertsAtTheRightPlace) {
-  for (auto i = 0; i < list.max_size() - 1; i++) {
+  for (std::size_t i = 0; i < list.max_size() - 1; i++) {
     list.push_back(content[i]);
   }
 
@@ -401,7 +682,7 @@ TEST_F(ArrayListStringTest, InsertsAtTheRightPlace) {
 }
 
 TEST_F(ArrayListStringTest, InsertInOrderIncreasesSize) {
-  for (auto i = 0; i < list.max_size(); i++) {
+  for (std::size_t i = 0; i < list.max_size(); i++) {
     list.insert_sorted("oi");
     ASSERT_EQ(i + 1, list.size());
   }
@@ -491,7 +772,7 @@ TEST_F(ArrayListStringTest, PopFrontDecreasesSize) {
 
 TEST_F(ArrayListStringTest, PopFrontRemovesFrontElement) {
   push_back_fill(content);
-  for (auto i = 0; i < list.max_size(); i++) {
+  for (std::size_t i = 0; i < list.max_size(); i++) {
     ASSERT_STREQ(list.pop_front(), content[i]);
   }
 }
@@ -547,3 +828,240 @@ TEST_F(ArrayListStringTest, ContainsReturnsTrueWhenContainsData) {
 
   ASSERT_TRUE(list.contains("Java"));
 }
+
+TEST_F(ArrayListStringTest, GrowableListInsertsSortedWhenFull) {
+  structures::ArrayListString growable{1u, true};
+  for (auto i = 0; i < 10; i++) {
+    growable.insert_sorted(content[i]);
+  }
+  ASSERT_EQ(growable.size(), 10);
+  ASSERT_STREQ(growable[0], "C");
+  ASSERT_STREQ(growable[9], "Smalltalk");
+}
+
+TEST_F(ArrayListStringTest, LowerAndUpperBound) {
+  for (auto i = 0; i < 10; i++) {
+    list.insert_sorted(content[i]);
+  }
+  ASSERT_EQ(list.lower_bound("A"), 0);
+  ASSERT_EQ(list.lower_bound("C"), 0);
+  ASSERT_EQ(list.upper_bound("C"), 1);
+  ASSERT_EQ(list.lower_bound("Java"), 4);
+  ASSERT_EQ(list.upper_bound("Java"), 5);
+  ASSERT_EQ(list.lower_bound("Zig"), 10);
+}
+
+TEST_F(ArrayListStringTest, FindSortedThrowsErrorWhenEmpty) {
+  ASSERT_THROW(list.find_sorted("C"), std::out_of_range);
+}
+
+TEST_F(ArrayListStringTest, FindSortedReturnsTheIndexOfData) {
+  for (auto i = 0; i < 10; i++) {
+    list.insert_sorted(content[i]);
+  }
+  for (auto i = 0; i < 10; i++) {
+    ASSERT_STREQ(content[i], list[list.find_sorted(content[i])]);
+  }
+  ASSERT_EQ(list.find_sorted("Rust"), list.size());
+}
+
+TEST_F(ArrayListStringTest, ConstructorsDefaultToHeapStorage) {
+  ASSERT_EQ(list.storage(), structures::ArrayListString::HEAP);
+  ASSERT_EQ(default_list.storage(), structures::ArrayListString::HEAP);
+}
+
+TEST_F(ArrayListStringTest, ArenaListStoresCopies) {
+  structures::ArrayListString arena_list{10u, false,
+                                         structures::ArrayListString::ARENA};
+  char buffer[] = "Haskell";
+  arena_list.push_back(buffer);
+  buffer[0] = 'X';
+  ASSERT_STREQ(arena_list[0], "Haskell");
+  ASSERT_NE(arena_list[0], buffer);
+}
+
+TEST_F(ArrayListStringTest, ArenaListBehavesLikeHeapList) {
+  structures::ArrayListString arena_list{1u, true,
+                                         structures::ArrayListString::ARENA};
+  for (auto i = 0; i < 10; i++) {
+    arena_list.insert_sorted(content[i]);
+  }
+  ASSERT_EQ(arena_list.size(), 10);
+  ASSERT_STREQ(arena_list[0], "C");
+  ASSERT_TRUE(arena_list.contains("Lisp"));
+  arena_list.remove("Lisp");
+  ASSERT_FALSE(arena_list.contains("Lisp"));
+  ASSERT_STREQ(arena_list.pop_front(), "C");
+  arena_list.clear();
+  ASSERT_TRUE(arena_list.empty());
+  arena_list.push_back("Go");
+  ASSERT_STREQ(arena_list[0], "Go");
+}
+
+TEST_F(ArrayListStringTest, ClearReleasesStrings) {
+  push_back_fill(content);
+  list.clear();
+  ASSERT_EQ(list.size(), 0);
+  list.push_back("Go");
+  ASSERT_STREQ(list[0], "Go");
+}
+
+class StringArenaTest : public ::testing::Test {
+ protected:
+  structures::StringArena arena{16u};
+};
+
+TEST_F(StringArenaTest, StartsWithoutChunks) {
+  ASSERT_EQ(arena.chunks(), 0u);
+}
+
+TEST_F(StringArenaTest, CopyTerminatesString) {
+  char* copy = arena.copy("abcdef", 3);
+  ASSERT_STREQ(copy, "abc");
+}
+
+TEST_F(StringArenaTest, CopiesShareChunks) {
+  char* first = arena.copy("abc", 3);
+  char* second = arena.copy("def", 3);
+  ASSERT_EQ(arena.chunks(), 1u);
+  ASSERT_EQ(second, first + 4);
+  ASSERT_STREQ(first, "abc");
+  ASSERT_STREQ(second, "def");
+}
+
+TEST_F(StringArenaTest, AllocatesNewChunkWhenFull) {
+  arena.copy("0123456789", 10);
+  char* copy = arena.copy("0123456789", 10);
+  ASSERT_EQ(arena.chunks(), 2u);
+  ASSERT_STREQ(copy, "0123456789");
+}
+
+TEST_F(StringArenaTest, CopiesLongStringsToOwnChunk) {
+  const char* data = "a string longer than the chunk size";
+  char* copy = arena.copy(data, strlen(data));
+  ASSERT_STREQ(copy, data);
+}
+
+TEST_F(StringArenaTest, ClearKeepsOneChunk) {
+  for (auto i = 0; i < 10; i++) {
+    arena.copy("0123456789", 10);
+  }
+  ASSERT_EQ(arena.chunks(), 10u);
+  arena.clear();
+  ASSERT_EQ(arena.chunks(), 1u);
+  arena.copy("abc", 3);
+  ASSERT_EQ(arena.chunks(), 1u);
+}
+
+class StringEntryTest : public ::testing::Test {
+ protected:
+  structures::StringEntry entry(const char* data) {
+    return structures::StringEntry(const_cast<char*>(data), strlen(data));
+  }
+
+  // Compara o resultado de operator< com o de strcmp.
+  void assert_same_order(const char* lhs, const char* rhs) {
+    ASSERT_EQ(entry(lhs) < entry(rhs), strcmp(lhs, rhs) < 0) << lhs << rhs;
+    ASSERT_EQ(entry(rhs) < entry(lhs), strcmp(rhs, lhs) < 0) << lhs << rhs;
+    ASSERT_EQ(entry(lhs) == entry(rhs), strcmp(lhs, rhs) == 0) << lhs << rhs;
+  }
+};
+
+TEST_F(StringEntryTest, CachesLengthAndPrefix) {
+  auto short_entry = entry("abc");
+  ASSERT_EQ(short_entry.length, 3u);
+  ASSERT_EQ(memcmp(short_entry.prefix, "abc\0\0\0\0\0\0\0\0\0", 12), 0);
+
+  auto long_entry = entry("abcdefghijklmnop");
+  ASSERT_EQ(long_entry.length, 16u);
+  ASSERT_EQ(memcmp(long_entry.prefix, "abcdefghijkl", 12), 0);
+}
+
+TEST_F(StringEntryTest, ComparesShortStrings) {
+  assert_same_order("", "");
+  assert_same_order("", "a");
+  assert_same_order("abc", "abc");
+  assert_same_order("abc", "abd");
+  assert_same_order("abc", "abcd");
+  assert_same_order("b", "abcd");
+}
+
+TEST_F(StringEntryTest, ComparesStringsLongerThanPrefix) {
+  assert_same_order("abcdefghijkl", "abcdefghijkl");
+  assert_same_order("abcdefghijkl", "abcdefghijklm");
+  assert_same_order("abcdefghijklmnop", "abcdefghijklmnop");
+  assert_same_order("abcdefghijklmnop", "abcdefghijklmnoq");
+  assert_same_order("abcdefghijklmnop", "abcdefghijklmno");
+  assert_same_order("abcdefghijkz", "abcdefghijklmnop");
+}
+
+TEST_F(StringEntryTest, ComparesNonAsciiLikeStrcmp) {
+  assert_same_order("\xc3\xa1rvore", "arvore");
+  assert_same_order("identifier_\xff_long", "identifier_a_long");
+}
+
+TEST_F(ArrayListStringTest, FindsStringsSharingLongPrefix) {
+  list.push_back("identifier_000001");
+  list.push_back("identifier_000002");
+  list.push_back("identifier_000003");
+  ASSERT_EQ(list.find("identifier_000002"), 1);
+  ASSERT_EQ(list.find("identifier_000004"), 3);
+  ASSERT_TRUE(list.contains("identifier_000003"));
+  ASSERT_FALSE(list.contains("identifier_00000"));
+}
+
+class LinearFindTest : public ::testing::Test {
+ protected:
+  // Para cada tamanho até 70 e cada posição, compara linear_find com
+  // scalar_find, inclusive quando o elemento não está presente.
+  template <typename T>
+  void assert_matches_scalar(void) {
+    T contents[70];
+    for (auto size = 0u; size <= 70u; size++) {
+      for (auto i = 0u; i < size; i++) {
+        contents[i] = static_cast<T>(i + 1);
+      }
+      ASSERT_EQ(size, structures::linear_find(contents, size, T(0)));
+      for (auto position = 0u; position < size; position++) {
+        T data = contents[position];
+        ASSERT_EQ(structures::scalar_find(contents, size, data),
+                  structures::linear_find(contents, size, data));
+        ASSERT_EQ(position, structures::linear_find(contents, size, data));
+      }
+    }
+  }
+};
+
+TEST_F(LinearFindTest, MatchesScalarFindForEveryLaneWidth) {
+  assert_matches_scalar<std::int8_t>();
+  assert_matches_scalar<std::int16_t>();
+  assert_matches_scalar<int>();
+  assert_matches_scalar<std::int64_t>();
+  assert_matches_scalar<float>();
+  assert_matches_scalar<double>();
+}
+
+TEST_F(LinearFindTest, ReturnsFirstOccurrence) {
+  int contents[40] = {};
+  contents[17] = 5;
+  contents[33] = 5;
+  ASSERT_EQ(17u, structures::linear_find(contents, 40, 5));
+}
+
+TEST_F(LinearFindTest, ComparesOnlyBothHalvesOf64BitIntegers) {
+  std::int64_t contents[8] = {};
+  contents[3] = 0x0000000100000002;
+  ASSERT_EQ(8u, structures::linear_find(contents, 8, std::int64_t{2}));
+  ASSERT_EQ(8u, structures::linear_find(contents, 8,
+                                        std::int64_t{0x0000000100000000}));
+  ASSERT_EQ(3u, structures::linear_find(contents, 8,
+                                        std::int64_t{0x0000000100000002}));
+}
+
+TEST_F(LinearFindTest, FollowsFloatingPointEquality) {
+  double contents[16] = {};
+  contents[5] = -0.0;
+  contents[9] = NAN;
+  ASSERT_EQ(0u, structures::linear_find(contents, 16, -0.0));
+  ASSERT_EQ(16u, structures::linear_find(contents, 16, double(NAN)));
+}
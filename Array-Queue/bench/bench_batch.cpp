@@ -0,0 +1,78 @@
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "circular_array_queue.h"
+
+// Custo por elemento da CircularArrayQueue<int> em lotes de 1, 16 e 256:
+// enqueue/dequeue um a um, enqueue_bulk/dequeue_bulk e enqueue_bulk com
+// processamento no lugar por peek_spans e consume. ITEMS elementos passam
+// por uma fila de CAPACITY posições, que dá a volta várias vezes; cada
+// elemento retirado é somado.
+
+namespace {
+const std::size_t ITEMS = 1u << 24;
+const std::size_t CAPACITY = 1000u;
+const std::size_t BATCHES[] = {1u, 16u, 256u};
+
+template <typename F>
+double measure(F operation) {
+  auto start = std::chrono::steady_clock::now();
+  operation();
+  auto end = std::chrono::steady_clock::now();
+  std::chrono::duration<double, std::nano> elapsed = end - start;
+  return elapsed.count();
+}
+}  // namespace
+
+int main(void) {
+  std::printf("%-10s %14s %14s %14s\n", "batch", "single ns", "bulk ns",
+              "spans ns");
+  long long checksum = 0;
+  for (auto batch : BATCHES) {
+    std::vector<int> input(batch);
+    std::vector<int> output(batch);
+    for (std::size_t i = 0; i != batch; i++) {
+      input[i] = static_cast<int>(i);
+    }
+    structures::CircularArrayQueue<int> queue{CAPACITY};
+
+    double single = measure([&] {
+      for (std::size_t done = 0; done < ITEMS; done += batch) {
+        for (auto data : input) {
+          queue.enqueue(data);
+        }
+        for (std::size_t i = 0; i != batch; i++) {
+          checksum += queue.dequeue();
+        }
+      }
+    });
+
+    double bulk = measure([&] {
+      for (std::size_t done = 0; done < ITEMS; done += batch) {
+        queue.enqueue_bulk(input.begin(), input.end());
+        queue.dequeue_bulk(output.begin(), batch);
+        for (auto data : output) {
+          checksum += data;
+        }
+      }
+    });
+
+    double spans = measure([&] {
+      for (std::size_t done = 0; done < ITEMS; done += batch) {
+        queue.enqueue_bulk(input.begin(), input.end());
+        auto ready = queue.peek_spans();
+        for (auto span : {ready.first, ready.second}) {
+          for (auto data : span) {
+            checksum += data;
+          }
+        }
+        queue.consume(batch);
+      }
+    });
+
+    std::printf("%-10zu %14.2f %14.2f %14.2f\n", batch, single / ITEMS,
+                bulk / ITEMS, spans / ITEMS);
+  }
+  return checksum == 0;
+}
@@ -0,0 +1,40 @@
+#include <chrono>
+#include <cstdio>
+
+#include "array_queue.h"
+
+// Esvaziamento de uma ArrayQueue<int> cheia, de 10K a 1M elementos. Antes do
+// índice de início, cada dequeue deslocava todos os elementos restantes e
+// esvaziar a fila custava O(n²); agora o custo por elemento é constante.
+
+namespace {
+const std::size_t SIZES[] = {10000u, 100000u, 1000000u};
+
+template <typename F>
+double measure(F operation) {
+  auto start = std::chrono::steady_clock::now();
+  operation();
+  auto end = std::chrono::steady_clock::now();
+  std::chrono::duration<double, std::milli> elapsed = end - start;
+  return elapsed.count();
+}
+}  // namespace
+
+int main(void) {
+  std::printf("%-10s %14s %14s\n", "size", "drain ms", "Mitems/s");
+  long long checksum = 0;
+  for (auto size : SIZES) {
+    structures::ArrayQueue<int> queue{size};
+    for (std::size_t i = 0; i != size; i++) {
+      queue.enqueue(static_cast<int>(i));
+    }
+
+    double drain = measure([&] {
+      while (!queue.empty()) {
+        checksum += queue.dequeue();
+      }
+    });
+    std::printf("%-10zu %14.3f %14.1f\n", size, drain, size / drain / 1e3);
+  }
+  return checksum == 0;
+}
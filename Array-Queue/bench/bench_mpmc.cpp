@@ -0,0 +1,115 @@
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "circular_array_queue.h"
+#include "mpmc_circular_array_queue.h"
+
+// Escalabilidade com várias produtoras e consumidoras: ITEMS inteiros
+// divididos igualmente entre THREADS[i] produtoras e THREADS[i]
+// consumidoras, por uma fila de CAPACITY posições. Compara a
+// MpmcCircularArrayQueue com a CircularArrayQueue protegida por um mutex.
+// Uma thread que encontra a fila cheia ou vazia tenta de novo algumas vezes
+// e depois cede a CPU (yield).
+
+namespace {
+const std::size_t ITEMS = 1u << 21;
+const std::size_t CAPACITY = 1024u;
+const std::size_t THREADS[] = {1u, 2u, 4u, 8u};
+
+//! CircularArrayQueue com um mutex em volta de cada operação
+class LockedQueue {
+ public:
+  explicit LockedQueue(std::size_t max_size) : queue_{max_size} {}
+
+  bool try_enqueue(int data) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (queue_.full()) {
+      return false;
+    }
+    queue_.enqueue(data);
+    return true;
+  }
+
+  bool try_dequeue(int& data) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (queue_.empty()) {
+      return false;
+    }
+    data = queue_.dequeue();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  structures::CircularArrayQueue<int> queue_;
+};
+
+template <typename Queue>
+void push(Queue& queue, int data) {
+  for (int spins = 0; !queue.try_enqueue(data); spins++) {
+    if (spins >= 64) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+template <typename Queue>
+int pop(Queue& queue) {
+  int data;
+  for (int spins = 0; !queue.try_dequeue(data); spins++) {
+    if (spins >= 64) {
+      std::this_thread::yield();
+    }
+  }
+  return data;
+}
+
+//! Elementos por segundo, em milhões
+template <typename Queue>
+double throughput(std::size_t threads, long long& checksum) {
+  Queue queue{CAPACITY};
+  std::size_t share = ITEMS / threads;
+  std::vector<long long> sums(threads, 0);
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  for (std::size_t t = 0; t != threads; t++) {
+    workers.emplace_back([&queue, share] {
+      for (std::size_t i = 0; i != share; i++) {
+        push(queue, static_cast<int>(i));
+      }
+    });
+    workers.emplace_back([&queue, &sums, share, t] {
+      for (std::size_t i = 0; i != share; i++) {
+        sums[t] += pop(queue);
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  for (auto sum : sums) {
+    checksum += sum;
+  }
+  std::chrono::duration<double, std::micro> elapsed = end - start;
+  return ITEMS / elapsed.count();
+}
+}  // namespace
+
+int main(void) {
+  std::printf("%-10s %14s %14s\n", "threads", "mutex Mit/s", "mpmc Mit/s");
+  long long checksum = 0;
+  for (auto threads : THREADS) {
+    double locked = throughput<LockedQueue>(threads, checksum);
+    double mpmc = throughput<structures::MpmcCircularArrayQueue<int>>(
+        threads, checksum);
+    std::printf("%zux%-8zu %14.1f %14.1f\n", threads, threads, locked, mpmc);
+  }
+  return checksum == 0;
+}
@@ -0,0 +1,42 @@
+#include <chrono>
+#include <cstdio>
+
+#include "circular_array_queue.h"
+
+// Vazão de uma só thread da CircularArrayQueue<int>: com a fila pela metade,
+// OPERATIONS pares enqueue/dequeue. Com tamanho máximo qualquer, a posição no
+// vetor é calculada por divisão; com potência de 2, por máscara.
+
+namespace {
+const std::size_t OPERATIONS = 1u << 26;
+const std::size_t SIZES[] = {1000u, 1024u, 100000u, 131072u};
+
+template <typename F>
+double measure(F operation) {
+  auto start = std::chrono::steady_clock::now();
+  operation();
+  auto end = std::chrono::steady_clock::now();
+  std::chrono::duration<double, std::micro> elapsed = end - start;
+  return elapsed.count();
+}
+}  // namespace
+
+int main(void) {
+  std::printf("%-10s %14s\n", "max_size", "Mops/s");
+  long long checksum = 0;
+  for (auto size : SIZES) {
+    structures::CircularArrayQueue<int> queue{size};
+    for (std::size_t i = 0; i != size / 2; i++) {
+      queue.enqueue(static_cast<int>(i));
+    }
+
+    double elapsed = measure([&] {
+      for (std::size_t i = 0; i != OPERATIONS; i++) {
+        queue.enqueue(static_cast<int>(i));
+        checksum += queue.dequeue();
+      }
+    });
+    std::printf("%-10zu %14.1f\n", size, 2 * OPERATIONS / elapsed);
+  }
+  return checksum == 0;
+}
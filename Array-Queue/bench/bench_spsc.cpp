@@ -0,0 +1,128 @@
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "circular_array_queue.h"
+#include "spsc_circular_array_queue.h"
+
+// Uma thread produtora e uma consumidora trocando inteiros. Compara a
+// SpscCircularArrayQueue com a CircularArrayQueue protegida por um mutex,
+// como era usada entre threads. Vazão: ITEMS elementos por uma fila de
+// CAPACITY posições. Latência: um elemento vai por uma fila e volta por
+// outra, ROUND_TRIPS vezes; a latência de ida é metade da volta completa.
+// Um lado que encontra a fila cheia ou vazia cede a CPU (yield).
+
+namespace {
+const std::size_t ITEMS = 4000000u;
+const std::size_t CAPACITY = 1024u;
+const std::size_t ROUND_TRIPS = 200000u;
+
+//! CircularArrayQueue com um mutex em volta de cada operação
+class LockedQueue {
+ public:
+  explicit LockedQueue(std::size_t max_size) : queue_{max_size} {}
+
+  bool try_enqueue(int data) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (queue_.full()) {
+      return false;
+    }
+    queue_.enqueue(data);
+    return true;
+  }
+
+  bool try_dequeue(int& data) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (queue_.empty()) {
+      return false;
+    }
+    data = queue_.dequeue();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  structures::CircularArrayQueue<int> queue_;
+};
+
+template <typename Queue>
+void push(Queue& queue, int data) {
+  while (!queue.try_enqueue(data)) {
+    std::this_thread::yield();
+  }
+}
+
+template <typename Queue>
+int pop(Queue& queue) {
+  int data;
+  while (!queue.try_dequeue(data)) {
+    std::this_thread::yield();
+  }
+  return data;
+}
+
+template <typename F>
+double measure(F operation) {
+  auto start = std::chrono::steady_clock::now();
+  operation();
+  auto end = std::chrono::steady_clock::now();
+  std::chrono::duration<double, std::nano> elapsed = end - start;
+  return elapsed.count();
+}
+
+//! Elementos por segundo, em milhões
+template <typename Queue>
+double throughput(long long& checksum) {
+  Queue queue{CAPACITY};
+  double elapsed = measure([&] {
+    std::thread producer{[&queue] {
+      for (std::size_t i = 0; i != ITEMS; i++) {
+        push(queue, static_cast<int>(i));
+      }
+    }};
+    for (std::size_t i = 0; i != ITEMS; i++) {
+      checksum += pop(queue);
+    }
+    producer.join();
+  });
+  return ITEMS / elapsed * 1e3;
+}
+
+//! Latência de ida, em ns
+template <typename Queue>
+double latency(long long& checksum) {
+  Queue ping{CAPACITY};
+  Queue pong{CAPACITY};
+  double elapsed = measure([&] {
+    std::thread echo{[&ping, &pong] {
+      for (std::size_t i = 0; i != ROUND_TRIPS; i++) {
+        push(pong, pop(ping));
+      }
+    }};
+    for (std::size_t i = 0; i != ROUND_TRIPS; i++) {
+      push(ping, static_cast<int>(i));
+      checksum += pop(pong);
+    }
+    echo.join();
+  });
+  return elapsed / ROUND_TRIPS / 2;
+}
+
+template <typename Queue>
+void report(const char* name, long long& checksum) {
+  double items = throughput<Queue>(checksum);
+  double one_way = latency<Queue>(checksum);
+  std::printf("%-24s %14.1f %14.1f\n", name, items, one_way);
+}
+}  // namespace
+
+int main(void) {
+  std::printf("%-24s %14s %14s\n", "queue", "Mitems/s", "one-way ns");
+  long long checksum = 0;
+  report<LockedQueue>("mutex CircularArrayQueue", checksum);
+  report<structures::SpscCircularArrayQueue<int>>("SpscCircularArrayQueue",
+                                                  checksum);
+  return checksum == 0;
+}
@@ -0,0 +1,32 @@
+#include "array_queue.h"
+#include "benchmark.h"
+#include "circular_array_queue.h"
+
+// Suíte de desempenho da ArrayQueue e da CircularArrayQueue (ver
+// benchmark::Suite). Para cada tamanho: insert (enqueue), lookup (back) e
+// remove (dequeue).
+
+namespace {
+template <typename Queue>
+void run(benchmark::Suite& suite, const char* container, std::size_t size) {
+  Queue queue{size};
+  suite.measure(container, "insert", size, size,
+                [&](std::size_t i) { queue.enqueue(static_cast<int>(i)); });
+
+  suite.measure(container, "lookup", size, size,
+                [&](std::size_t) { benchmark::keep(queue.back()); });
+
+  suite.measure(container, "remove", size, size,
+                [&](std::size_t) { benchmark::keep(queue.dequeue()); });
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  benchmark::Suite suite{argc, argv};
+  for (auto size : suite.sizes()) {
+    run<structures::ArrayQueue<int>>(suite, "ArrayQueue", size);
+    run<structures::CircularArrayQueue<int>>(suite, "CircularArrayQueue",
+                                             size);
+  }
+  return 0;
+}
@@ -2,6 +2,7 @@
 #define STRUCTURES_ARRAY_QUEUE_H_
 
 #include <cstdint>
+#include <utility>
 
 namespace structures {
 template <typename T>
@@ -9,6 +10,13 @@ template <typename T>
 /*!
    Classe fila em vetor com tipo genérico, com movimentação de dados.
    Implementada utilizando um vetor estático.
+
+   O início da fila avança pelo vetor a cada desenfileira, sem mover os
+   demais elementos. Os elementos só voltam para o início do vetor quando o
+   final da fila alcança o fim do vetor (ver move_forward), ou de graça
+   quando a fila esvazia. Esvaziar uma fila de n elementos custa O(n); com a
+   fila quase cheia e enfileira/desenfileira alternados, cada enfileira pode
+   mover todos os elementos, caso em que a CircularArrayQueue é preferível.
  */
 class ArrayQueue {
  public:
@@ -27,12 +35,31 @@ class ArrayQueue {
    */
   explicit ArrayQueue(std::size_t max_size);
 
+  //! Construtor de movimento
+  /*!
+     Cria uma fila tomando para si o vetor de other, sem copiar os elementos.
+     other fica vazia e com tamanho máximo zero.
+
+     \param other: Fila de origem (ArrayQueue&&).
+   */
+  ArrayQueue(ArrayQueue&& other);
+
   //! Destrutor
   /*!
      Usado para destruir o objeto quando não for mais utilizado
    */
   ~ArrayQueue(void);
 
+  //! Atribuição por movimento
+  /*!
+     Libera o vetor atual e toma para si o vetor de other, sem copiar os
+     elementos. other fica vazia e com tamanho máximo zero.
+
+     \param other: Fila de origem (ArrayQueue&&).
+     \return Referência para esta fila (ArrayQueue&).
+   */
+  ArrayQueue& operator=(ArrayQueue&& other);
+
   //! Método enfileira
   /*!
      Efileira elemento no final da fila, se houver espaço. Se não houver
@@ -43,12 +70,36 @@ class ArrayQueue {
    */
   void enqueue(const T& data);
 
+  //! Método enfileira (movimento)
+  /*!
+     Como enqueue(const T&), mas move data para a fila em vez de copiá-lo.
+
+     \param data: Elemento a ser movido para a fila (T&&).
+   */
+  void enqueue(T&& data);
+
+  //! Método constrói no final da fila
+  /*!
+     Constrói um elemento com os argumentos args e o enfileira. As posições do
+     vetor já estão construídas, então o elemento é construído uma vez e movido
+     para o final da fila, sem cópias. Se não houver espaço, lança exceção
+     (out_of_range).
+
+     \param args: Argumentos repassados ao construtor de T.
+     \return Referência ao elemento enfileirado (T&).
+   */
+  template <typename... Args>
+  T& emplace(Args&&... args) {
+    enqueue(T(std::forward<Args>(args)...));
+    return back();
+  }
+
   //! Método desenfileira
   /*!
       Desenfilera o elemento no início da fila, se houver elementos. Se não
       houver elementos, lança exceção (out_of_range).
 
-      \return Elemento removido (T).
+      \return Elemento removido, movido para fora da fila (T).
    */
   T dequeue(void);
 
@@ -62,7 +113,7 @@ class ArrayQueue {
 
   //! Método limpar
   /*!
-     Limpa a fila. Atribui -1 para o tamanho da fila.
+     Limpa a fila.
    */
   void clear(void);
 
@@ -105,7 +156,8 @@ class ArrayQueue {
  private:
   //! Método move para frente
   /*!
-     Move elementos da fila para frente. Copia elemento em [i + 1] para posição [i].
+     Move os elementos da fila para o início do vetor, em bloco (ver
+     relocate_overlapping), liberando as posições já desenfileiradas.
    */
   void move_forward(void);
 
@@ -115,10 +167,15 @@ class ArrayQueue {
   */
   T* contents;
 
+  //! Início
+  /*!
+     Índice do elemento no início da fila.
+  */
+  std::size_t begin_;
 
   //! Tamanho
   /*!
-     Tamanho atual da fila. Inicializado em -1.
+     Tamanho atual da fila.
   */
   std::size_t size_;
 
@@ -1,8 +1,11 @@
 #ifndef STRUCTURES_CIRCULAR_ARRAY_QUEUE_H_
 #define STRUCTURES_CIRCULAR_ARRAY_QUEUE_H_
 
+#include <algorithm>
 #include <cstdint>
+#include <iterator>
 #include <stdexcept>
+#include <utility>
 
 #include "array_queue.h"
 
@@ -12,9 +15,28 @@ template <typename T>
 /*!
    Classe fila circular em vetor de tipo genérico. Sem movimentação de dados.
    Implementado utilizando um vetor estático.
+
+   O início e o final da fila são contadores de 64 bits que só crescem
+   (elementos já desenfileirados e já enfileirados); o tamanho é a diferença
+   entre eles. A posição de um contador no vetor é o resto da divisão pelo
+   tamanho máximo ou, quando o tamanho máximo é potência de 2, os bits
+   baixos do contador, sem divisão.
 */
 class CircularArrayQueue : public ArrayQueue<T> {
  public:
+  //! Trecho contíguo do vetor
+  /*!
+     Elementos consecutivos da fila, em [data, data + size). Pode ser
+     percorrido com for de intervalo.
+   */
+  struct Span {
+    T* data;
+    std::size_t size;
+
+    T* begin(void) const { return data; }
+    T* end(void) const { return data + size; }
+  };
+
   //! Construtor padrão
   /*!
      Cria uma fila circular utilizando o atributo privado de tamanho padrão como
@@ -30,12 +52,31 @@ class CircularArrayQueue : public ArrayQueue<T> {
   */
   explicit CircularArrayQueue(std::size_t max_size);
 
+  //! Construtor de movimento
+  /*!
+     Cria uma fila circular tomando para si o vetor de other, sem copiar os
+     elementos. other fica vazia e com tamanho máximo zero.
+
+     \param other: Fila de origem (CircularArrayQueue&&).
+   */
+  CircularArrayQueue(CircularArrayQueue&& other);
+
   //! Destrutor
   /*!
      Usado para destruir o objeto quando não for mais utilizado.
   */
   ~CircularArrayQueue(void);
 
+  //! Atribuição por movimento
+  /*!
+     Libera o vetor atual e toma para si o vetor de other, sem copiar os
+     elementos. other fica vazia e com tamanho máximo zero.
+
+     \param other: Fila de origem (CircularArrayQueue&&).
+     \return Referência para esta fila (CircularArrayQueue&).
+   */
+  CircularArrayQueue& operator=(CircularArrayQueue&& other);
+
   //! Método enfileira
   /*!
      Enfileira elemento no final da fila, se houver espaço. Se não houver
@@ -46,15 +87,106 @@ class CircularArrayQueue : public ArrayQueue<T> {
   */
   void enqueue(const T& data);
 
+  //! Método enfileira (movimento)
+  /*!
+     Como enqueue(const T&), mas move data para a fila em vez de copiá-lo.
+
+     \param data: Elemento a ser movido para a fila (T&&).
+   */
+  void enqueue(T&& data);
+
+  //! Método constrói no final da fila
+  /*!
+     Constrói um elemento com os argumentos args e o enfileira. As posições do
+     vetor já estão construídas, então o elemento é construído uma vez e movido
+     para o final da fila, sem cópias. Se não houver espaço, lança exceção
+     (out_of_range).
+
+     \param args: Argumentos repassados ao construtor de T.
+     \return Referência ao elemento enfileirado (T&).
+   */
+  template <typename... Args>
+  T& emplace(Args&&... args) {
+    enqueue(T(std::forward<Args>(args)...));
+    return back();
+  }
+
   //! Método desenfileira
   /*!
      Desenfileira o elemento no início da fila, se houver elementos. Se não
      houver elementos, lança exceção (out_of_range).
 
-     \return Elemento removido (T).
+     \return Elemento removido, movido para fora da fila (T).
   */
   T dequeue(void);
 
+  //! Método enfileira intervalo
+  /*!
+     Enfileira, em ordem, cópias dos elementos de [first, last), com uma só
+     verificação de espaço e no máximo duas cópias em bloco (antes e depois
+     de o vetor dar a volta). Se não houver espaço para todos, lança exceção
+     (out_of_range) sem enfileirar nenhum.
+
+     \param first: Início do intervalo (ForwardIt).
+     \param last: Fim do intervalo (ForwardIt).
+   */
+  template <typename ForwardIt>
+  void enqueue_bulk(ForwardIt first, ForwardIt last) {
+    auto count = static_cast<std::size_t>(std::distance(first, last));
+    if (count > max_size_ - size()) {
+      throw std::out_of_range("Not enough space on queue");
+    }
+    if (count == 0) {
+      return;
+    }
+    std::size_t tail = position(end_);
+    ForwardIt middle = std::next(first, std::min(count, max_size_ - tail));
+    std::copy(first, middle, contents + tail);
+    std::copy(middle, last, contents);
+    end_ += count;
+  }
+
+  //! Método desenfileira em bloco
+  /*!
+     Move para out até count elementos do início da fila, em ordem, e os
+     remove da fila.
+
+     \param out: Destino dos elementos (OutputIt).
+     \param count: Quantidade máxima de elementos (size_t).
+     \return Quantidade de elementos removidos (size_t).
+   */
+  template <typename OutputIt>
+  std::size_t dequeue_bulk(OutputIt out, std::size_t count) {
+    count = std::min(count, size());
+    auto spans = peek_spans();
+    std::size_t head = std::min(count, spans.first.size);
+    out = std::move(spans.first.data, spans.first.data + head, out);
+    std::move(spans.second.data, spans.second.data + (count - head), out);
+    consume(count);
+    return count;
+  }
+
+  //! Método trechos
+  /*!
+     Elementos da fila, do início ao final, sem copiá-los: o primeiro trecho
+     vai do início da fila até o fim do vetor ou o final da fila; o segundo,
+     vazio se a fila não der a volta, continua do início do vetor. Os trechos
+     valem até a próxima operação que altere a fila.
+
+     \return Os dois trechos, em ordem (std::pair<Span, Span>).
+   */
+  std::pair<Span, Span> peek_spans(void);
+
+  //! Método consome
+  /*!
+     Remove count elementos do início da fila, normalmente depois de
+     processá-los por peek_spans. Se a fila tiver menos de count elementos,
+     lança exceção (out_of_range).
+
+     \param count: Quantidade de elementos (size_t).
+   */
+  void consume(std::size_t count);
+
   //! Método final da fila
   /*!
      Retorna por referência o elemento no final da fila circular.
@@ -91,9 +223,9 @@ class CircularArrayQueue : public ArrayQueue<T> {
 
   //! Método tamanho
   /*!
-     Getter do atributo size_, retorna o tamanho atual da fila.
+     Retorna o tamanho atual da fila, a diferença entre os contadores.
 
-     \return tamanho máximo da fila (size_t)
+     \return tamanho atual da fila (size_t)
    */
   std::size_t size(void) const;
 
@@ -106,36 +238,47 @@ class CircularArrayQueue : public ArrayQueue<T> {
   std::size_t max_size(void) const;
 
  private:
+  //! Método posição
+  /*!
+     Posição no vetor do elemento de número counter.
+   */
+  std::size_t position(std::uint64_t counter) const {
+    if (mask_ != 0) {
+      return static_cast<std::size_t>(counter & mask_);
+    }
+    return static_cast<std::size_t>(counter % max_size_);
+  }
+
   //! Conteúdo
   /*!
      Ponteiro para tipo genérico, armazena elementos.
   */
   T* contents;
 
-  //! Tamanho
-  /*!
-     Tamanho atual da fila circular. Inicializado em -1.
-  */
-  std::size_t size_;
-
   //! Tamanho máximo
   /*!
      Capacidade máxima da fila circular.
   */
   std::size_t max_size_;
 
+  //! Máscara
+  /*!
+     max_size_ - 1 quando max_size_ é potência de 2 maior que 1; senão zero,
+     e as posições são calculadas por divisão.
+  */
+  std::size_t mask_;
+
   //! Início
   /*!
-     Indíce do elemento no ínicio da fila circular.
+     Quantidade de elementos já desenfileirados.
   */
-  int begin_;
+  std::uint64_t begin_;
 
   //! Fim
   /*!
-     Índice do elemento no final da fila circular.
+     Quantidade de elementos já enfileirados.
   */
-  int end_;
-
+  std::uint64_t end_;
 
   //! Tamanho máximo padrão
   /*!
@@ -0,0 +1,228 @@
+#ifndef STRUCTURES_MPMC_CIRCULAR_ARRAY_QUEUE_H_
+#define STRUCTURES_MPMC_CIRCULAR_ARRAY_QUEUE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+namespace structures {
+template <typename T>
+//! Classe MpmcCircularArrayQueue
+/*!
+   Fila circular em vetor, de tamanho máximo fixo, para várias threads
+   produtoras e consumidoras, sem travas (algoritmo de Vyukov).
+
+   begin_ e end_ contam quantos elementos já foram retirados e reservados
+   desde a criação; a posição de um contador no vetor é o resto da divisão
+   pelo tamanho máximo. Cada posição guarda um número de sequência que diz de
+   qual volta ela está à espera: igual ao dobro do contador de fim, está livre
+   para a produtora que o reservar; igual ao dobro do contador de início mais
+   um, guarda um elemento pronto para a consumidora que o reservar. O dobro
+   mantém os dois estados distintos mesmo com uma só posição, em que a volta
+   seguinte começa logo após a atual. As threads disputam só o contador
+   (compare_exchange) e depois leem ou escrevem a posição sem interferir umas
+   com as outras.
+ */
+class MpmcCircularArrayQueue {
+ public:
+  //! Construtor padrão
+  /*!
+     Cria uma fila utilizando o atributo privado de tamanho padrão como
+     tamanho máximo.
+   */
+  MpmcCircularArrayQueue(void);
+
+  //! Construtor com parâmetro de tamanho máximo
+  /*!
+     Cria a fila, atribuindo ao tamanho máximo o parâmetro max_size. Lança
+     exceção (invalid_argument) se max_size for zero.
+
+     \param max_size: Tamanho máximo da fila (size_t).
+   */
+  explicit MpmcCircularArrayQueue(std::size_t max_size);
+
+  //! A fila é compartilhada entre threads e não pode ser copiada ou movida.
+  MpmcCircularArrayQueue(const MpmcCircularArrayQueue&) = delete;
+  MpmcCircularArrayQueue& operator=(const MpmcCircularArrayQueue&) = delete;
+
+  //! Destrutor
+  /*!
+     Usado para destruir o objeto quando não for mais utilizado.
+   */
+  ~MpmcCircularArrayQueue(void);
+
+  //! Método tenta enfileirar
+  /*!
+     Enfileira uma cópia de data no final da fila, se houver espaço.
+
+     \param data: Elemento a ser enfileirado (const T&).
+     \return true: Elemento enfileirado (bool).
+     \return false: Fila cheia (bool).
+   */
+  bool try_enqueue(const T& data);
+
+  //! Método tenta enfileirar (movimento)
+  /*!
+     Como try_enqueue(const T&), mas move data para a fila. Se a fila estiver
+     cheia, data não é modificado.
+
+     \param data: Elemento a ser movido para a fila (T&&).
+     \return true: Elemento enfileirado (bool).
+     \return false: Fila cheia (bool).
+   */
+  bool try_enqueue(T&& data);
+
+  //! Método tenta desenfileirar
+  /*!
+     Move o elemento no início da fila para data, se houver elementos.
+
+     \param data: Destino do elemento removido (T&).
+     \return true: Elemento removido (bool).
+     \return false: Fila vazia (bool).
+   */
+  bool try_dequeue(T& data);
+
+  //! Método espera e enfileira
+  /*!
+     Como try_enqueue, mas, com a fila cheia, espera até haver espaço.
+
+     \param data: Elemento a ser enfileirado (const T&).
+   */
+  void wait_enqueue(const T& data);
+
+  //! Método espera e enfileira (movimento)
+  /*!
+     Como wait_enqueue(const T&), mas move data para a fila.
+
+     \param data: Elemento a ser movido para a fila (T&&).
+   */
+  void wait_enqueue(T&& data);
+
+  //! Método espera e desenfileira
+  /*!
+     Como try_dequeue, mas, com a fila vazia, espera até haver um elemento.
+
+     \return Elemento removido, movido para fora da fila (T).
+   */
+  T wait_dequeue(void);
+
+  //! Método enfileira
+  /*!
+     Como try_enqueue, mas lança exceção (out_of_range) se a fila estiver
+     cheia.
+
+     \param data: Elemento a ser enfileirado (const T&).
+   */
+  void enqueue(const T& data);
+
+  //! Método enfileira (movimento)
+  /*!
+     Como enqueue(const T&), mas move data para a fila em vez de copiá-lo.
+
+     \param data: Elemento a ser movido para a fila (T&&).
+   */
+  void enqueue(T&& data);
+
+  //! Método desenfileira
+  /*!
+     Como try_dequeue, mas lança exceção (out_of_range) se a fila estiver
+     vazia.
+
+     \return Elemento removido, movido para fora da fila (T).
+   */
+  T dequeue(void);
+
+  //! Método vazio
+  /*!
+     Verifica se a fila está vazia. Com outras threads em andamento, o
+     resultado pode já estar desatualizado ao retornar.
+
+     \return true: Fila vazia (bool).
+     \return false: Fila contém elementos (bool).
+   */
+  bool empty(void) const;
+
+  //! Método cheio
+  /*!
+     Verifica se a fila está cheia. Com outras threads em andamento, o
+     resultado pode já estar desatualizado ao retornar.
+
+     \return true: Fila cheia (bool).
+     \return false: Fila não está cheia (bool).
+   */
+  bool full(void) const;
+
+  //! Método tamanho
+  /*!
+     Retorna o tamanho atual da fila, contando elementos reservados por
+     operações ainda em andamento.
+
+     \return Tamanho atual da fila (size_t).
+   */
+  std::size_t size(void) const;
+
+  //! Método tamanho máximo
+  /*!
+     Retorna o tamanho máximo da fila.
+
+     \return Tamanho máximo da fila (size_t).
+   */
+  std::size_t max_size(void) const;
+
+ private:
+  //! Tamanho de uma linha de cache
+  static constexpr std::size_t CACHE_LINE = 64u;
+
+  //! Tentativas antes de ceder a CPU nos métodos que esperam
+  static constexpr int SPINS = 64;
+
+  //! Posição do vetor
+  struct Cell {
+    std::atomic<std::size_t> sequence;
+    T data;
+  };
+
+  //! Método reserva fim
+  /*!
+     Reserva a posição do próximo elemento a enfileirar.
+
+     \return Posição reservada, ou nullptr se a fila estiver cheia (Cell*).
+   */
+  Cell* reserve_end(std::size_t& end);
+
+  //! Método publica
+  /*!
+     Torna visível às consumidoras o elemento escrito em cell.
+   */
+  void publish(Cell* cell, std::size_t end) {
+    cell->sequence.store(2 * end + 1, std::memory_order_release);
+  }
+
+  //! Conteúdo
+  Cell* cells_;
+
+  //! Tamanho máximo
+  std::size_t max_size_;
+
+  //! Fim
+  /*!
+     Quantidade de posições já reservadas por produtoras.
+   */
+  alignas(CACHE_LINE) std::atomic<std::size_t> end_{0u};
+
+  //! Início
+  /*!
+     Quantidade de posições já reservadas por consumidoras.
+   */
+  alignas(CACHE_LINE) std::atomic<std::size_t> begin_{0u};
+
+  //! Tamanho máximo padrão
+  /*!
+     Capacidade máxima da fila, usado pelo construtor padrão
+   */
+  static const auto DEFAULT_SIZE = 10u;
+};
+}  // namespace structures
+
+#endif
@@ -0,0 +1,194 @@
+#ifndef STRUCTURES_SPSC_CIRCULAR_ARRAY_QUEUE_H_
+#define STRUCTURES_SPSC_CIRCULAR_ARRAY_QUEUE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+namespace structures {
+template <typename T>
+//! Classe SpscCircularArrayQueue
+/*!
+   Fila circular em vetor para exatamente uma thread produtora e uma thread
+   consumidora, sem travas. Apenas a produtora chama os métodos enfileira e
+   apenas a consumidora chama os métodos desenfileira; os demais podem ser
+   chamados por qualquer uma das duas.
+
+   Cada lado escreve só o próprio índice (end_ ou begin_), publicado com
+   release e lido pelo outro lado com acquire, o que torna visível o elemento
+   escrito antes do índice. Os dois índices ficam em linhas de cache
+   distintas, junto com a cópia que cada lado guarda do índice do outro: o
+   índice alheio só é relido quando a cópia indica fila cheia ou vazia.
+ */
+class SpscCircularArrayQueue {
+ public:
+  //! Construtor padrão
+  /*!
+     Cria uma fila utilizando o atributo privado de tamanho padrão como
+     tamanho máximo.
+   */
+  SpscCircularArrayQueue(void);
+
+  //! Construtor com parâmetro de tamanho máximo
+  /*!
+     Cria a fila, atribuindo ao tamanho máximo o parâmetro max_size.
+
+     \param max_size: Tamanho máximo da fila (size_t).
+   */
+  explicit SpscCircularArrayQueue(std::size_t max_size);
+
+  //! A fila é compartilhada entre threads e não pode ser copiada ou movida.
+  SpscCircularArrayQueue(const SpscCircularArrayQueue&) = delete;
+  SpscCircularArrayQueue& operator=(const SpscCircularArrayQueue&) = delete;
+
+  //! Destrutor
+  /*!
+     Usado para destruir o objeto quando não for mais utilizado.
+   */
+  ~SpscCircularArrayQueue(void);
+
+  //! Método tenta enfileirar
+  /*!
+     Enfileira uma cópia de data no final da fila, se houver espaço. Só pode
+     ser chamado pela thread produtora.
+
+     \param data: Elemento a ser enfileirado (const T&).
+     \return true: Elemento enfileirado (bool).
+     \return false: Fila cheia (bool).
+   */
+  bool try_enqueue(const T& data);
+
+  //! Método tenta enfileirar (movimento)
+  /*!
+     Como try_enqueue(const T&), mas move data para a fila. Se a fila estiver
+     cheia, data não é modificado.
+
+     \param data: Elemento a ser movido para a fila (T&&).
+     \return true: Elemento enfileirado (bool).
+     \return false: Fila cheia (bool).
+   */
+  bool try_enqueue(T&& data);
+
+  //! Método tenta desenfileirar
+  /*!
+     Move o elemento no início da fila para data, se houver elementos. Só
+     pode ser chamado pela thread consumidora.
+
+     \param data: Destino do elemento removido (T&).
+     \return true: Elemento removido (bool).
+     \return false: Fila vazia (bool).
+   */
+  bool try_dequeue(T& data);
+
+  //! Método enfileira
+  /*!
+     Como try_enqueue, mas lança exceção (out_of_range) se a fila estiver
+     cheia.
+
+     \param data: Elemento a ser enfileirado (const T&).
+   */
+  void enqueue(const T& data);
+
+  //! Método enfileira (movimento)
+  /*!
+     Como enqueue(const T&), mas move data para a fila em vez de copiá-lo.
+
+     \param data: Elemento a ser movido para a fila (T&&).
+   */
+  void enqueue(T&& data);
+
+  //! Método desenfileira
+  /*!
+     Como try_dequeue, mas lança exceção (out_of_range) se a fila estiver
+     vazia.
+
+     \return Elemento removido, movido para fora da fila (T).
+   */
+  T dequeue(void);
+
+  //! Método vazio
+  /*!
+     Verifica se a fila está vazia. Com as duas threads em andamento, o
+     resultado pode já estar desatualizado ao retornar.
+
+     \return true: Fila vazia (bool).
+     \return false: Fila contém elementos (bool).
+   */
+  bool empty(void) const;
+
+  //! Método cheio
+  /*!
+     Verifica se a fila está cheia. Com as duas threads em andamento, o
+     resultado pode já estar desatualizado ao retornar.
+
+     \return true: Fila cheia (bool).
+     \return false: Fila não está cheia (bool).
+   */
+  bool full(void) const;
+
+  //! Método tamanho
+  /*!
+     Retorna o tamanho atual da fila, calculado a partir dos dois índices.
+
+     \return Tamanho atual da fila (size_t).
+   */
+  std::size_t size(void) const;
+
+  //! Método tamanho máximo
+  /*!
+     Retorna o tamanho máximo da fila.
+
+     \return Tamanho máximo da fila (size_t).
+   */
+  std::size_t max_size(void) const;
+
+ private:
+  //! Tamanho de uma linha de cache
+  static constexpr std::size_t CACHE_LINE = 64u;
+
+  //! Método próximo
+  /*!
+     Índice seguinte a index no vetor circular, sem divisão.
+   */
+  std::size_t next(std::size_t index) const {
+    return index + 1 == slots_ ? 0u : index + 1;
+  }
+
+  //! Conteúdo
+  /*!
+     Vetor com max_size + 1 posições: uma fica sempre livre, para distinguir
+     fila cheia de fila vazia sem um contador compartilhado.
+   */
+  T* contents;
+
+  //! Posições do vetor
+  std::size_t slots_;
+
+  //! Fim
+  /*!
+     Índice da posição após o último elemento. Escrito pela produtora.
+   */
+  alignas(CACHE_LINE) std::atomic<std::size_t> end_{0u};
+
+  //! Cópia de begin_ vista pela produtora
+  std::size_t begin_cache_{0u};
+
+  //! Início
+  /*!
+     Índice do primeiro elemento. Escrito pela consumidora.
+   */
+  alignas(CACHE_LINE) std::atomic<std::size_t> begin_{0u};
+
+  //! Cópia de end_ vista pela consumidora
+  std::size_t end_cache_{0u};
+
+  //! Tamanho máximo padrão
+  /*!
+     Capacidade máxima da fila, usado pelo construtor padrão
+   */
+  static const auto DEFAULT_SIZE = 10u;
+};
+}  // namespace structures
+
+#endif
@@ -1,32 +1,82 @@
 #include "array_queue.h"
 
 #include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "relocate.h"
 
 template <typename T>
 structures::ArrayQueue<T>::ArrayQueue(void) {
   max_size_ = DEFAULT_SIZE;
-  size_ = -1;
+  begin_ = 0;
+  size_ = 0;
   contents = new T[max_size_];
 }
 
 template <typename T>
 structures::ArrayQueue<T>::ArrayQueue(std::size_t max_size) {
   max_size_ = max_size;
-  size_ = -1;
+  begin_ = 0;
+  size_ = 0;
   contents = new T[max_size_];
 }
 
+template <typename T>
+structures::ArrayQueue<T>::ArrayQueue(ArrayQueue&& other) {
+  max_size_ = other.max_size_;
+  begin_ = other.begin_;
+  size_ = other.size_;
+  contents = other.contents;
+  other.max_size_ = 0;
+  other.begin_ = 0;
+  other.size_ = 0;
+  other.contents = nullptr;
+}
+
 template <typename T>
 structures::ArrayQueue<T>::~ArrayQueue(void) {
   delete[] contents;
 }
 
+template <typename T>
+structures::ArrayQueue<T>& structures::ArrayQueue<T>::operator=(
+    ArrayQueue&& other) {
+  if (this != &other) {
+    delete[] contents;
+    max_size_ = other.max_size_;
+    begin_ = other.begin_;
+    size_ = other.size_;
+    contents = other.contents;
+    other.max_size_ = 0;
+    other.begin_ = 0;
+    other.size_ = 0;
+    other.contents = nullptr;
+  }
+  return *this;
+}
+
 template <typename T>
 void structures::ArrayQueue<T>::enqueue(const T& data) {
   if (full()) {
     throw std::out_of_range("Cannot enqueue on full queue");
   } else {
-    contents[++size_] = data;
+    if (begin_ + size_ == max_size_) {
+      move_forward();
+    }
+    contents[begin_ + size_++] = data;
+  }
+}
+
+template <typename T>
+void structures::ArrayQueue<T>::enqueue(T&& data) {
+  if (full()) {
+    throw std::out_of_range("Cannot enqueue on full queue");
+  } else {
+    if (begin_ + size_ == max_size_) {
+      move_forward();
+    }
+    contents[begin_ + size_++] = std::move(data);
   }
 }
 
@@ -35,9 +85,10 @@ T structures::ArrayQueue<T>::dequeue(void) {
   if (empty()) {
     throw std::out_of_range("Cannot dequeue an empty queue");
   }
-  T data = contents[0];
+  T data = std::move(contents[begin_]);
   size_--;
-  move_forward();
+  // Fila vazia: o próximo elemento volta ao início do vetor sem mover nada.
+  begin_ = size_ == 0 ? 0 : begin_ + 1;
   return data;
 }
 
@@ -46,12 +97,13 @@ T& structures::ArrayQueue<T>::back(void) {
   if (empty()) {
     throw std::out_of_range("Empty queue");
   }
-  return contents[size_];
+  return contents[begin_ + size_ - 1];
 }
 
 template <typename T>
 void structures::ArrayQueue<T>::clear(void) {
-  size_ = -1;
+  begin_ = 0;
+  size_ = 0;
 }
 
 template <typename T>
@@ -66,7 +118,7 @@ bool structures::ArrayQueue<T>::full(void) const {
 
 template <typename T>
 std::size_t structures::ArrayQueue<T>::size(void) const {
-  return size_ + 1;
+  return size_;
 }
 
 template <typename T>
@@ -76,9 +128,9 @@ std::size_t structures::ArrayQueue<T>::max_size(void) const {
 
 template <typename T>
 void structures::ArrayQueue<T>::move_forward(void) {
-  for (auto i = 0; i != size(); i++) {
-    contents[i] = contents[i + 1];
-  }
+  relocate_overlapping(contents, contents + begin_, size_);
+  begin_ = 0;
 }
 
 template class structures::ArrayQueue<int>;
+template class structures::ArrayQueue<std::string>;
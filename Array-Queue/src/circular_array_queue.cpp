@@ -1,36 +1,85 @@
 #include "circular_array_queue.h"
 
+#include <algorithm>
+#include <string>
+#include <utility>
+
 template <typename T>
 structures::CircularArrayQueue<T>::CircularArrayQueue(void) {
   max_size_ = DEFAULT_SIZE;
+  mask_ = 0;
   begin_ = 0;
-  end_ = -1;
-  size_ = 0;
+  end_ = 0;
   contents = new T[max_size_];
 }
 
 template <typename T>
 structures::CircularArrayQueue<T>::CircularArrayQueue(std::size_t max_size) {
   max_size_ = max_size;
+  mask_ = max_size > 1 && (max_size & (max_size - 1)) == 0 ? max_size - 1 : 0;
   begin_ = 0;
-  end_ = -1;
-  size_ = 0;
+  end_ = 0;
   contents = new T[max_size_];
 }
 
+template <typename T>
+structures::CircularArrayQueue<T>::CircularArrayQueue(
+    CircularArrayQueue&& other)
+    : ArrayQueue<T>(std::move(other)) {
+  max_size_ = other.max_size_;
+  mask_ = other.mask_;
+  begin_ = other.begin_;
+  end_ = other.end_;
+  contents = other.contents;
+  other.max_size_ = 0;
+  other.mask_ = 0;
+  other.begin_ = 0;
+  other.end_ = 0;
+  other.contents = nullptr;
+}
+
 template <typename T>
 structures::CircularArrayQueue<T>::~CircularArrayQueue(void) {
   delete[] contents;
 }
 
+template <typename T>
+structures::CircularArrayQueue<T>& structures::CircularArrayQueue<T>::operator=(
+    CircularArrayQueue&& other) {
+  if (this != &other) {
+    ArrayQueue<T>::operator=(std::move(other));
+    delete[] contents;
+    max_size_ = other.max_size_;
+    mask_ = other.mask_;
+    begin_ = other.begin_;
+    end_ = other.end_;
+    contents = other.contents;
+    other.max_size_ = 0;
+    other.mask_ = 0;
+    other.begin_ = 0;
+    other.end_ = 0;
+    other.contents = nullptr;
+  }
+  return *this;
+}
+
 template <typename T>
 void structures::CircularArrayQueue<T>::enqueue(const T& data) {
   if (full()) {
     throw std::out_of_range("Cannot enqueue on full queue");
   } else {
-    end_ = (end_ + 1) % max_size_;
-    contents[end_] = data;
-    size_++;
+    contents[position(end_)] = data;
+    end_++;
+  }
+}
+
+template <typename T>
+void structures::CircularArrayQueue<T>::enqueue(T&& data) {
+  if (full()) {
+    throw std::out_of_range("Cannot enqueue on full queue");
+  } else {
+    contents[position(end_)] = std::move(data);
+    end_++;
   }
 }
 
@@ -39,42 +88,61 @@ T structures::CircularArrayQueue<T>::dequeue(void) {
   if (empty()) {
     throw std::out_of_range("Cannot dequeue from empty queue");
   } else {
-    T data = contents[begin_];
-    begin_ = (begin_ + 1) % max_size_;
-    size_--;
+    T data = std::move(contents[position(begin_)]);
+    begin_++;
     return data;
   }
 }
 
+template <typename T>
+std::pair<typename structures::CircularArrayQueue<T>::Span,
+          typename structures::CircularArrayQueue<T>::Span>
+structures::CircularArrayQueue<T>::peek_spans(void) {
+  if (empty()) {
+    return {Span{contents, 0u}, Span{contents, 0u}};
+  }
+  std::size_t first = position(begin_);
+  std::size_t head = std::min(size(), max_size_ - first);
+  return {Span{contents + first, head}, Span{contents, size() - head}};
+}
+
+template <typename T>
+void structures::CircularArrayQueue<T>::consume(std::size_t count) {
+  if (count > size()) {
+    throw std::out_of_range("Cannot consume more than the queue holds");
+  } else {
+    begin_ += count;
+  }
+}
+
 template <typename T>
 T& structures::CircularArrayQueue<T>::back(void) {
   if (empty()) {
     throw std::out_of_range("Queue is empty");
   } else {
-    return contents[end_];
+    return contents[position(end_ - 1)];
   }
 }
 
 template <typename T>
 void structures::CircularArrayQueue<T>::clear(void) {
   begin_ = 0;
-  end_ = -1;
-  size_ = 0;
+  end_ = 0;
 }
 
 template <typename T>
 bool structures::CircularArrayQueue<T>::empty(void) const {
-  return size_ == 0;
+  return begin_ == end_;
 }
 
 template <typename T>
 bool structures::CircularArrayQueue<T>::full(void) const {
-  return size_ == max_size_;
+  return size() == max_size_;
 }
 
 template <typename T>
 std::size_t structures::CircularArrayQueue<T>::size(void) const {
-  return size_;
+  return static_cast<std::size_t>(end_ - begin_);
 }
 
 template <typename T>
@@ -83,3 +151,4 @@ std::size_t structures::CircularArrayQueue<T>::max_size(void) const {
 }
 
 template class structures::CircularArrayQueue<int>;
+template class structures::CircularArrayQueue<std::string>;
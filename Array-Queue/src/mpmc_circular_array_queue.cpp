@@ -0,0 +1,178 @@
+#include "mpmc_circular_array_queue.h"
+
+#include <string>
+#include <thread>
+#include <utility>
+
+template <typename T>
+structures::MpmcCircularArrayQueue<T>::MpmcCircularArrayQueue(void)
+    : MpmcCircularArrayQueue(DEFAULT_SIZE) {}
+
+template <typename T>
+structures::MpmcCircularArrayQueue<T>::MpmcCircularArrayQueue(
+    std::size_t max_size) {
+  if (max_size == 0) {
+    throw std::invalid_argument("Queue must hold at least one element");
+  }
+  max_size_ = max_size;
+  cells_ = new Cell[max_size_];
+  for (std::size_t i = 0; i != max_size_; i++) {
+    cells_[i].sequence.store(2 * i, std::memory_order_relaxed);
+  }
+}
+
+template <typename T>
+structures::MpmcCircularArrayQueue<T>::~MpmcCircularArrayQueue(void) {
+  delete[] cells_;
+}
+
+template <typename T>
+typename structures::MpmcCircularArrayQueue<T>::Cell*
+structures::MpmcCircularArrayQueue<T>::reserve_end(std::size_t& end) {
+  end = end_.load(std::memory_order_relaxed);
+  while (true) {
+    Cell* cell = &cells_[end % max_size_];
+    std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+    if (sequence == 2 * end) {
+      // Posição livre nesta volta: disputa o contador com as demais.
+      if (end_.compare_exchange_weak(end, end + 1,
+                                     std::memory_order_relaxed)) {
+        return cell;
+      }
+    } else if (sequence < 2 * end) {
+      // Ainda guarda o elemento da volta anterior: fila cheia.
+      return nullptr;
+    } else {
+      // Outra produtora já reservou esta posição.
+      end = end_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+template <typename T>
+bool structures::MpmcCircularArrayQueue<T>::try_enqueue(const T& data) {
+  std::size_t end;
+  Cell* cell = reserve_end(end);
+  if (cell == nullptr) {
+    return false;
+  }
+  cell->data = data;
+  publish(cell, end);
+  return true;
+}
+
+template <typename T>
+bool structures::MpmcCircularArrayQueue<T>::try_enqueue(T&& data) {
+  std::size_t end;
+  Cell* cell = reserve_end(end);
+  if (cell == nullptr) {
+    return false;
+  }
+  cell->data = std::move(data);
+  publish(cell, end);
+  return true;
+}
+
+template <typename T>
+bool structures::MpmcCircularArrayQueue<T>::try_dequeue(T& data) {
+  std::size_t begin = begin_.load(std::memory_order_relaxed);
+  while (true) {
+    Cell* cell = &cells_[begin % max_size_];
+    std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+    if (sequence == 2 * begin + 1) {
+      if (begin_.compare_exchange_weak(begin, begin + 1,
+                                       std::memory_order_relaxed)) {
+        data = std::move(cell->data);
+        // Libera a posição para a produtora da próxima volta.
+        cell->sequence.store(2 * (begin + max_size_),
+                             std::memory_order_release);
+        return true;
+      }
+    } else if (sequence < 2 * begin + 1) {
+      return false;
+    } else {
+      begin = begin_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+template <typename T>
+void structures::MpmcCircularArrayQueue<T>::wait_enqueue(const T& data) {
+  for (int spins = 0; !try_enqueue(data); spins++) {
+    if (spins >= SPINS) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+template <typename T>
+void structures::MpmcCircularArrayQueue<T>::wait_enqueue(T&& data) {
+  for (int spins = 0; !try_enqueue(std::move(data)); spins++) {
+    if (spins >= SPINS) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+template <typename T>
+T structures::MpmcCircularArrayQueue<T>::wait_dequeue(void) {
+  T data;
+  for (int spins = 0; !try_dequeue(data); spins++) {
+    if (spins >= SPINS) {
+      std::this_thread::yield();
+    }
+  }
+  return data;
+}
+
+template <typename T>
+void structures::MpmcCircularArrayQueue<T>::enqueue(const T& data) {
+  if (!try_enqueue(data)) {
+    throw std::out_of_range("Cannot enqueue on full queue");
+  }
+}
+
+template <typename T>
+void structures::MpmcCircularArrayQueue<T>::enqueue(T&& data) {
+  if (!try_enqueue(std::move(data))) {
+    throw std::out_of_range("Cannot enqueue on full queue");
+  }
+}
+
+template <typename T>
+T structures::MpmcCircularArrayQueue<T>::dequeue(void) {
+  T data;
+  if (!try_dequeue(data)) {
+    throw std::out_of_range("Cannot dequeue from empty queue");
+  }
+  return data;
+}
+
+template <typename T>
+bool structures::MpmcCircularArrayQueue<T>::empty(void) const {
+  return size() == 0;
+}
+
+template <typename T>
+bool structures::MpmcCircularArrayQueue<T>::full(void) const {
+  return size() == max_size_;
+}
+
+template <typename T>
+std::size_t structures::MpmcCircularArrayQueue<T>::size(void) const {
+  std::size_t begin = begin_.load(std::memory_order_acquire);
+  std::size_t end = end_.load(std::memory_order_acquire);
+  // Os contadores podem avançar entre as duas leituras.
+  if (end <= begin) {
+    return 0u;
+  }
+  return end - begin < max_size_ ? end - begin : max_size_;
+}
+
+template <typename T>
+std::size_t structures::MpmcCircularArrayQueue<T>::max_size(void) const {
+  return max_size_;
+}
+
+template class structures::MpmcCircularArrayQueue<int>;
+template class structures::MpmcCircularArrayQueue<std::string>;
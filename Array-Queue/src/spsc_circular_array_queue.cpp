@@ -0,0 +1,112 @@
+#include "spsc_circular_array_queue.h"
+
+#include <string>
+#include <utility>
+
+template <typename T>
+structures::SpscCircularArrayQueue<T>::SpscCircularArrayQueue(void)
+    : SpscCircularArrayQueue(DEFAULT_SIZE) {}
+
+template <typename T>
+structures::SpscCircularArrayQueue<T>::SpscCircularArrayQueue(
+    std::size_t max_size) {
+  slots_ = max_size + 1;
+  contents = new T[slots_];
+}
+
+template <typename T>
+structures::SpscCircularArrayQueue<T>::~SpscCircularArrayQueue(void) {
+  delete[] contents;
+}
+
+template <typename T>
+bool structures::SpscCircularArrayQueue<T>::try_enqueue(const T& data) {
+  std::size_t end = end_.load(std::memory_order_relaxed);
+  std::size_t after = next(end);
+  if (after == begin_cache_) {
+    begin_cache_ = begin_.load(std::memory_order_acquire);
+    if (after == begin_cache_) {
+      return false;
+    }
+  }
+  contents[end] = data;
+  end_.store(after, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+bool structures::SpscCircularArrayQueue<T>::try_enqueue(T&& data) {
+  std::size_t end = end_.load(std::memory_order_relaxed);
+  std::size_t after = next(end);
+  if (after == begin_cache_) {
+    begin_cache_ = begin_.load(std::memory_order_acquire);
+    if (after == begin_cache_) {
+      return false;
+    }
+  }
+  contents[end] = std::move(data);
+  end_.store(after, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+bool structures::SpscCircularArrayQueue<T>::try_dequeue(T& data) {
+  std::size_t begin = begin_.load(std::memory_order_relaxed);
+  if (begin == end_cache_) {
+    end_cache_ = end_.load(std::memory_order_acquire);
+    if (begin == end_cache_) {
+      return false;
+    }
+  }
+  data = std::move(contents[begin]);
+  begin_.store(next(begin), std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+void structures::SpscCircularArrayQueue<T>::enqueue(const T& data) {
+  if (!try_enqueue(data)) {
+    throw std::out_of_range("Cannot enqueue on full queue");
+  }
+}
+
+template <typename T>
+void structures::SpscCircularArrayQueue<T>::enqueue(T&& data) {
+  if (!try_enqueue(std::move(data))) {
+    throw std::out_of_range("Cannot enqueue on full queue");
+  }
+}
+
+template <typename T>
+T structures::SpscCircularArrayQueue<T>::dequeue(void) {
+  T data;
+  if (!try_dequeue(data)) {
+    throw std::out_of_range("Cannot dequeue from empty queue");
+  }
+  return data;
+}
+
+template <typename T>
+bool structures::SpscCircularArrayQueue<T>::empty(void) const {
+  return size() == 0;
+}
+
+template <typename T>
+bool structures::SpscCircularArrayQueue<T>::full(void) const {
+  return size() == max_size();
+}
+
+template <typename T>
+std::size_t structures::SpscCircularArrayQueue<T>::size(void) const {
+  std::size_t begin = begin_.load(std::memory_order_acquire);
+  std::size_t end = end_.load(std::memory_order_acquire);
+  return end >= begin ? end - begin : end + slots_ - begin;
+}
+
+template <typename T>
+std::size_t structures::SpscCircularArrayQueue<T>::max_size(void) const {
+  return slots_ - 1;
+}
+
+template class structures::SpscCircularArrayQueue<int>;
+template class structures::SpscCircularArrayQueue<std::string>;
@@ -1,7 +1,14 @@
+#include <iterator>
 #include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "array_queue.h"
 #include "circular_array_queue.h"
+#include "mpmc_circular_array_queue.h"
+#include "spsc_circular_array_queue.h"
 #include "gtest/gtest.h"
 
 int main(int argc, char* argv[]) {
@@ -125,6 +132,46 @@ TEST_F(ArrayQueueTest, DequeueReturnsCorrectElement) {
   }
 }
 
+TEST_F(ArrayQueueTest, MoveConstructorTakesElements) {
+  fill();
+  structures::ArrayQueue<int> moved{std::move(queue)};
+  ASSERT_EQ(20u, moved.size());
+  ASSERT_EQ(0, moved.dequeue());
+  ASSERT_TRUE(queue.empty());
+  ASSERT_EQ(0u, queue.max_size());
+}
+
+TEST_F(ArrayQueueTest, EnqueueRvalueAndEmplaceMoveStrings) {
+  structures::ArrayQueue<std::string> strings{2u};
+  std::string enqueued(64, 'q');
+  strings.enqueue(std::move(enqueued));
+  ASSERT_TRUE(enqueued.empty());
+  ASSERT_EQ("eee", strings.emplace(3u, 'e'));
+  ASSERT_THROW(strings.emplace("full"), std::out_of_range);
+  ASSERT_EQ(std::string(64, 'q'), strings.dequeue());
+  ASSERT_EQ("eee", strings.dequeue());
+}
+
+TEST_F(ArrayQueueTest, InterleavedOperationsKeepOrder) {
+  auto enqueued = 0;
+  auto dequeued = 0;
+  for (auto round = 0; round < 10; round++) {
+    while (!queue.full()) {
+      queue.enqueue(enqueued++);
+    }
+    ASSERT_EQ(enqueued - 1, queue.back());
+    for (auto i = 0; i < 7; i++) {
+      ASSERT_EQ(dequeued++, queue.dequeue());
+    }
+  }
+  while (!queue.empty()) {
+    ASSERT_EQ(dequeued++, queue.dequeue());
+  }
+  ASSERT_EQ(enqueued, dequeued);
+  queue.enqueue(-1);
+  ASSERT_EQ(-1, queue.back());
+}
+
 class CircularArrayQueueTest : public ::testing::Test {
  protected:
   structures::CircularArrayQueue<int> circular_queue{20};
@@ -238,3 +285,292 @@ TEST_F(CircularArrayQueueTest, DequeueReturnsCorrectElement) {
     ASSERT_EQ(i, circular_queue.dequeue());
   }
 }
+
+TEST_F(CircularArrayQueueTest, MoveAssignmentTakesElements) {
+  fill();
+  circular_queue.dequeue();
+  circular_queue.enqueue(20);
+  default_circular_queue = std::move(circular_queue);
+  ASSERT_EQ(20u, default_circular_queue.size());
+  ASSERT_EQ(20, default_circular_queue.back());
+  ASSERT_EQ(1, default_circular_queue.dequeue());
+  ASSERT_TRUE(circular_queue.empty());
+  ASSERT_EQ(0u, circular_queue.max_size());
+}
+
+TEST_F(CircularArrayQueueTest, EnqueueRvalueAndEmplaceMoveStrings) {
+  structures::CircularArrayQueue<std::string> strings{2u};
+  strings.enqueue(std::string(64, 'a'));
+  strings.emplace(64u, 'b');
+  ASSERT_EQ(std::string(64, 'a'), strings.dequeue());
+  std::string wrapped(64, 'c');
+  strings.enqueue(std::move(wrapped));
+  ASSERT_TRUE(wrapped.empty());
+  ASSERT_EQ(std::string(64, 'b'), strings.dequeue());
+  ASSERT_EQ(std::string(64, 'c'), strings.dequeue());
+}
+
+TEST_F(CircularArrayQueueTest, EnqueueBulkWrapsAround) {
+  std::vector<int> values(15);
+  for (auto i = 0; i < 15; i++) {
+    values[i] = i;
+  }
+  circular_queue.enqueue_bulk(values.begin(), values.end());
+  for (auto i = 0; i < 10; i++) {
+    ASSERT_EQ(i, circular_queue.dequeue());
+  }
+  circular_queue.enqueue_bulk(values.begin(), values.end());
+  ASSERT_EQ(20u, circular_queue.size());
+  ASSERT_EQ(14, circular_queue.back());
+  ASSERT_THROW(circular_queue.enqueue_bulk(values.begin(), values.begin() + 1),
+               std::out_of_range);
+
+  for (auto i = 10; i < 15; i++) {
+    ASSERT_EQ(i, circular_queue.dequeue());
+  }
+  for (auto i = 0; i < 15; i++) {
+    ASSERT_EQ(i, circular_queue.dequeue());
+  }
+}
+
+TEST_F(CircularArrayQueueTest, EnqueueBulkThrowsErrorWithoutEnoughSpace) {
+  std::vector<int> values(21, 1);
+  circular_queue.enqueue(0);
+  ASSERT_THROW(circular_queue.enqueue_bulk(values.begin(), values.end() - 1),
+               std::out_of_range);
+  ASSERT_EQ(1u, circular_queue.size());
+  circular_queue.enqueue_bulk(values.begin(), values.begin());
+  ASSERT_EQ(0, circular_queue.back());
+}
+
+TEST_F(CircularArrayQueueTest, DequeueBulkMovesUpToCount) {
+  fill();
+  for (auto i = 0; i < 12; i++) {
+    circular_queue.dequeue();
+    circular_queue.enqueue(20 + i);
+  }
+
+  std::vector<int> out;
+  ASSERT_EQ(15u, circular_queue.dequeue_bulk(std::back_inserter(out), 15));
+  ASSERT_EQ(5u, circular_queue.dequeue_bulk(std::back_inserter(out), 15));
+  ASSERT_EQ(0u, circular_queue.dequeue_bulk(std::back_inserter(out), 15));
+  ASSERT_TRUE(circular_queue.empty());
+  for (auto i = 0; i < 20; i++) {
+    ASSERT_EQ(12 + i, out[i]);
+  }
+}
+
+TEST_F(CircularArrayQueueTest, PeekSpansCoverQueueInOrder) {
+  auto spans = circular_queue.peek_spans();
+  ASSERT_EQ(0u, spans.first.size + spans.second.size);
+
+  fill();
+  for (auto i = 0; i < 5; i++) {
+    circular_queue.dequeue();
+    circular_queue.enqueue(20 + i);
+  }
+  spans = circular_queue.peek_spans();
+  ASSERT_EQ(15u, spans.first.size);
+  ASSERT_EQ(5u, spans.second.size);
+  auto expected = 5;
+  for (auto span : {spans.first, spans.second}) {
+    for (auto& data : span) {
+      ASSERT_EQ(expected++, data);
+      data = -data;
+    }
+  }
+
+  ASSERT_THROW(circular_queue.consume(21), std::out_of_range);
+  circular_queue.consume(16);
+  ASSERT_EQ(4u, circular_queue.size());
+  ASSERT_EQ(-21, circular_queue.dequeue());
+}
+
+TEST_F(CircularArrayQueueTest, PowerOfTwoSizeWrapsAround) {
+  structures::CircularArrayQueue<int> masked{16u};
+  auto enqueued = 0;
+  auto dequeued = 0;
+  for (auto round = 0; round < 10; round++) {
+    while (!masked.full()) {
+      masked.enqueue(enqueued++);
+    }
+    ASSERT_EQ(enqueued - 1, masked.back());
+    auto spans = masked.peek_spans();
+    ASSERT_EQ(16u, spans.first.size + spans.second.size);
+    ASSERT_EQ(dequeued, spans.first.data[0]);
+    for (auto i = 0; i < 7; i++) {
+      ASSERT_EQ(dequeued++, masked.dequeue());
+    }
+  }
+  masked.clear();
+  ASSERT_TRUE(masked.empty());
+  masked.enqueue(-1);
+  ASSERT_EQ(-1, masked.dequeue());
+}
+
+class SpscCircularArrayQueueTest : public ::testing::Test {
+ protected:
+  structures::SpscCircularArrayQueue<int> spsc_queue{20};
+};
+
+TEST_F(SpscCircularArrayQueueTest, TryEnqueueFailsWhenFull) {
+  for (auto i = 0; i < 20; i++) {
+    ASSERT_TRUE(spsc_queue.try_enqueue(i));
+  }
+  ASSERT_TRUE(spsc_queue.full());
+  ASSERT_EQ(20u, spsc_queue.size());
+  ASSERT_FALSE(spsc_queue.try_enqueue(20));
+  ASSERT_THROW(spsc_queue.enqueue(20), std::out_of_range);
+}
+
+TEST_F(SpscCircularArrayQueueTest, TryDequeueFailsWhenEmpty) {
+  int data = -1;
+  ASSERT_TRUE(spsc_queue.empty());
+  ASSERT_FALSE(spsc_queue.try_dequeue(data));
+  ASSERT_EQ(-1, data);
+  ASSERT_THROW(spsc_queue.dequeue(), std::out_of_range);
+}
+
+TEST_F(SpscCircularArrayQueueTest, KeepsOrderAcrossWrapAround) {
+  auto enqueued = 0;
+  auto dequeued = 0;
+  for (auto round = 0; round < 10; round++) {
+    while (spsc_queue.try_enqueue(enqueued)) {
+      enqueued++;
+    }
+    for (auto i = 0; i < 7; i++) {
+      ASSERT_EQ(dequeued++, spsc_queue.dequeue());
+    }
+  }
+  ASSERT_EQ(20u, spsc_queue.size() + 7);
+  while (!spsc_queue.empty()) {
+    ASSERT_EQ(dequeued++, spsc_queue.dequeue());
+  }
+  ASSERT_EQ(enqueued, dequeued);
+}
+
+TEST_F(SpscCircularArrayQueueTest, MovesStrings) {
+  structures::SpscCircularArrayQueue<std::string> strings{1u};
+  std::string data(64, 'a');
+  strings.enqueue(std::move(data));
+  ASSERT_TRUE(data.empty());
+  std::string rejected(64, 'b');
+  ASSERT_FALSE(strings.try_enqueue(std::move(rejected)));
+  ASSERT_EQ(std::string(64, 'b'), rejected);
+  ASSERT_EQ(std::string(64, 'a'), strings.dequeue());
+}
+
+TEST_F(SpscCircularArrayQueueTest, TransfersInOrderBetweenThreads) {
+  const auto count = 200000;
+  std::thread producer{[this, count] {
+    for (auto i = 0; i < count; i++) {
+      while (!spsc_queue.try_enqueue(i)) {
+        std::this_thread::yield();
+      }
+    }
+  }};
+
+  auto mismatches = 0;
+  for (auto i = 0; i < count; i++) {
+    int data;
+    while (!spsc_queue.try_dequeue(data)) {
+      std::this_thread::yield();
+    }
+    mismatches += data != i;
+  }
+  producer.join();
+  ASSERT_EQ(0, mismatches);
+  ASSERT_TRUE(spsc_queue.empty());
+}
+
+class MpmcCircularArrayQueueTest : public ::testing::Test {
+ protected:
+  structures::MpmcCircularArrayQueue<int> mpmc_queue{20};
+};
+
+TEST_F(MpmcCircularArrayQueueTest, ConstructorThrowsErrorWhenSizeIsZero) {
+  ASSERT_THROW(structures::MpmcCircularArrayQueue<int>{0u},
+               std::invalid_argument);
+  ASSERT_EQ(10u, structures::MpmcCircularArrayQueue<int>{}.max_size());
+}
+
+TEST_F(MpmcCircularArrayQueueTest, SizeOneHoldsOneElement) {
+  structures::MpmcCircularArrayQueue<int> single{1u};
+  for (auto i = 0; i < 3; i++) {
+    ASSERT_TRUE(single.try_enqueue(i));
+    ASSERT_FALSE(single.try_enqueue(-1));
+    ASSERT_TRUE(single.full());
+    ASSERT_EQ(i, single.dequeue());
+    int data;
+    ASSERT_FALSE(single.try_dequeue(data));
+  }
+}
+
+TEST_F(MpmcCircularArrayQueueTest, TryOperationsFailWhenFullOrEmpty) {
+  int data = -1;
+  ASSERT_FALSE(mpmc_queue.try_dequeue(data));
+  ASSERT_THROW(mpmc_queue.dequeue(), std::out_of_range);
+  for (auto i = 0; i < 20; i++) {
+    ASSERT_TRUE(mpmc_queue.try_enqueue(i));
+  }
+  ASSERT_TRUE(mpmc_queue.full());
+  ASSERT_FALSE(mpmc_queue.try_enqueue(20));
+  ASSERT_THROW(mpmc_queue.enqueue(20), std::out_of_range);
+  ASSERT_TRUE(mpmc_queue.try_dequeue(data));
+  ASSERT_EQ(0, data);
+  ASSERT_EQ(19u, mpmc_queue.size());
+}
+
+TEST_F(MpmcCircularArrayQueueTest, KeepsOrderAcrossWrapAround) {
+  auto enqueued = 0;
+  auto dequeued = 0;
+  for (auto round = 0; round < 10; round++) {
+    while (mpmc_queue.try_enqueue(enqueued)) {
+      enqueued++;
+    }
+    for (auto i = 0; i < 7; i++) {
+      ASSERT_EQ(dequeued++, mpmc_queue.wait_dequeue());
+    }
+  }
+  while (!mpmc_queue.empty()) {
+    ASSERT_EQ(dequeued++, mpmc_queue.dequeue());
+  }
+  ASSERT_EQ(enqueued, dequeued);
+}
+
+TEST_F(MpmcCircularArrayQueueTest, ThreadsTransferEveryElementOnce) {
+  const auto threads = 4;
+  const auto count = 50000;
+  std::vector<std::vector<int>> received(threads);
+  std::vector<std::thread> workers;
+  for (auto t = 0; t < threads; t++) {
+    workers.emplace_back([this, t, count] {
+      for (auto i = 0; i < count; i++) {
+        mpmc_queue.wait_enqueue(t * count + i);
+      }
+    });
+    workers.emplace_back([this, &received, t, count] {
+      for (auto i = 0; i < count; i++) {
+        received[t].push_back(mpmc_queue.wait_dequeue());
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  // Cada consumidora recebe os elementos de uma produtora em ordem.
+  std::vector<int> seen(threads * count, 0);
+  for (const auto& elements : received) {
+    std::vector<int> last(threads, -1);
+    for (auto data : elements) {
+      seen[data]++;
+      ASSERT_LT(last[data / count], data);
+      last[data / count] = data;
+    }
+  }
+  for (auto times : seen) {
+    ASSERT_EQ(1, times);
+  }
+  ASSERT_TRUE(mpmc_queue.empty());
+}
@@ -0,0 +1,21 @@
+#include "benchmark.h"
+#include "array_stack.h"
+
+// Suíte de desempenho da ArrayStack (ver benchmark::Suite). Para cada tamanho:
+// insert (push), lookup (top) e remove (pop).
+
+int main(int argc, char* argv[]) {
+  benchmark::Suite suite{argc, argv};
+  for (auto size : suite.sizes()) {
+    structures::ArrayStack<int> stack{size};
+    suite.measure("ArrayStack", "insert", size, size,
+                  [&](std::size_t i) { stack.push(static_cast<int>(i)); });
+
+    suite.measure("ArrayStack", "lookup", size, size,
+                  [&](std::size_t) { benchmark::keep(stack.top()); });
+
+    suite.measure("ArrayStack", "remove", size, size,
+                  [&](std::size_t) { benchmark::keep(stack.pop()); });
+  }
+  return 0;
+}
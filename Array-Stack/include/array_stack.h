@@ -3,6 +3,7 @@
 
 #include <cstdint>    // std::size_t
 #include <stdexcept>  // C++ exceptions
+#include <utility>    // std::forward, std::move
 
 namespace structures {
 template <typename T>
@@ -29,12 +30,31 @@ class ArrayStack {
    */
   explicit ArrayStack(std::size_t max_size);
 
+  //! Construtor de movimento
+  /*!
+     Cria uma pilha tomando para si o vetor de other, sem copiar os elementos.
+     other fica vazia e com tamanho máximo zero.
+
+     \param other: Pilha de origem (ArrayStack&&).
+   */
+  ArrayStack(ArrayStack&& other);
+
   //! Destrutor
   /*!
     Usado para destruir o objeto quando não for mais utilizado
    */
   ~ArrayStack(void);
 
+  //! Atribuição por movimento
+  /*!
+     Libera o vetor atual e toma para si o vetor de other, sem copiar os
+     elementos. other fica vazia e com tamanho máximo zero.
+
+     \param other: Pilha de origem (ArrayStack&&).
+     \return Referência para esta pilha (ArrayStack&).
+   */
+  ArrayStack& operator=(ArrayStack&& other);
+
   //! Método empilha
   /*!
      Empilha elemento no topo da pilha, se houver espaço. Se não houver espaço,
@@ -45,12 +65,36 @@ class ArrayStack {
    */
   void push(const T& data);
 
+  //! Método empilha (movimento)
+  /*!
+     Como push(const T&), mas move data para a pilha em vez de copiá-lo.
+
+     \param data: Elemento a ser movido para a pilha (T&&).
+   */
+  void push(T&& data);
+
+  //! Método constrói no topo
+  /*!
+     Constrói um elemento com os argumentos args e o empilha. As posições do
+     vetor já estão construídas, então o elemento é construído uma vez e movido
+     para o topo, sem cópias. Se não houver espaço, lança exceção
+     (out_of_range).
+
+     \param args: Argumentos repassados ao construtor de T.
+     \return Referência ao elemento empilhado (T&).
+   */
+  template <typename... Args>
+  T& emplace(Args&&... args) {
+    push(T(std::forward<Args>(args)...));
+    return contents[top_];
+  }
+
   //! Método desempilha.
   /*!
      Remove dado no topo da pilha o retorna, se houver elementos na pilha. Se
      não houver elementos, lança exceção (out_of_range).
 
-     \return Elemento removido (T).
+     \return Elemento removido, movido para fora da pilha (T).
    */
   T pop(void);
 
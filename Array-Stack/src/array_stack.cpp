@@ -2,6 +2,8 @@
 
 #include <cstdint>    // std::size_t
 #include <stdexcept>  // C++ exceptions
+#include <string>
+#include <utility>    // std::move
 
 template <typename T>
 structures::ArrayStack<T>::ArrayStack(void) {
@@ -17,11 +19,36 @@ structures::ArrayStack<T>::ArrayStack(size_t max_size) {
   contents = new T[max_size_];
 }
 
+template <typename T>
+structures::ArrayStack<T>::ArrayStack(ArrayStack&& other) {
+  max_size_ = other.max_size_;
+  top_ = other.top_;
+  contents = other.contents;
+  other.max_size_ = 0;
+  other.top_ = -1;
+  other.contents = nullptr;
+}
+
 template <typename T>
 structures::ArrayStack<T>::~ArrayStack(void) {
   delete[] contents;
 }
 
+template <typename T>
+structures::ArrayStack<T>& structures::ArrayStack<T>::operator=(
+    ArrayStack&& other) {
+  if (this != &other) {
+    delete[] contents;
+    max_size_ = other.max_size_;
+    top_ = other.top_;
+    contents = other.contents;
+    other.max_size_ = 0;
+    other.top_ = -1;
+    other.contents = nullptr;
+  }
+  return *this;
+}
+
 template <typename T>
 void structures::ArrayStack<T>::push(const T& data) {
   if (full()) {
@@ -30,12 +57,20 @@ void structures::ArrayStack<T>::push(const T& data) {
   contents[++top_] = data;
 }
 
+template <typename T>
+void structures::ArrayStack<T>::push(T&& data) {
+  if (full()) {
+    throw std::out_of_range("Stack Overflow");
+  }
+  contents[++top_] = std::move(data);
+}
+
 template <typename T>
 T structures::ArrayStack<T>::pop(void) {
   if (empty()) {
     throw std::out_of_range("Can't pop from empty stack");
   }
-  return contents[top_--];
+  return std::move(contents[top_--]);
 }
 
 template <typename T>
@@ -72,3 +107,4 @@ std::size_t structures::ArrayStack<T>::max_size(void) const {
 }
 
 template class structures::ArrayStack<int>;
+template class structures::ArrayStack<std::string>;
@@ -1,4 +1,6 @@
 #include <stdexcept>
+#include <string>
+#include <utility>
 
 #include "array_stack.h"
 #include "gtest/gtest.h"
@@ -123,3 +125,32 @@ TEST_F(ArrayStackTest, TopAsLhsWorks) {
   stack.top() = -2;
   ASSERT_EQ(-2, stack.top());
 }
+
+TEST_F(ArrayStackTest, MoveConstructorTakesElements) {
+  fill();
+  structures::ArrayStack<int> moved{std::move(stack)};
+  ASSERT_EQ(20u, moved.size());
+  ASSERT_EQ(19, moved.top());
+  ASSERT_TRUE(stack.empty());
+  ASSERT_EQ(0u, stack.max_size());
+}
+
+TEST_F(ArrayStackTest, PushRvalueAndEmplaceMoveStrings) {
+  structures::ArrayStack<std::string> strings{3u};
+  std::string pushed(64, 'p');
+  strings.push(std::move(pushed));
+  ASSERT_TRUE(pushed.empty());
+  ASSERT_EQ("eee", strings.emplace(3u, 'e'));
+  ASSERT_EQ(2u, strings.size());
+  strings.emplace();
+  ASSERT_THROW(strings.emplace("full"), std::out_of_range);
+}
+
+TEST_F(ArrayStackTest, PopMovesElementOut) {
+  structures::ArrayStack<std::string> strings{2u};
+  strings.push(std::string(64, 'a'));
+  strings.push(std::string(64, 'b'));
+  ASSERT_EQ(std::string(64, 'b'), strings.pop());
+  ASSERT_EQ(std::string(64, 'a'), strings.pop());
+  ASSERT_TRUE(strings.empty());
+}
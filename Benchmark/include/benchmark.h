@@ -0,0 +1,170 @@
+#ifndef BENCHMARK_BENCHMARK_H_
+#define BENCHMARK_BENCHMARK_H_
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+//! Custo de uma operação
+/*!
+   Complexidade de uma operação em função do tamanho da estrutura. Define
+   quantas operações Suite::operations mede para cada tamanho.
+ */
+enum Cost { CONSTANT, LOGARITHMIC, LINEAR };
+
+//! Função mantém valor
+/*!
+   Impede que o compilador descarte o cálculo de value, sem custo em tempo de
+   execução.
+
+   \param value: Referência constante ao valor a ser mantido (const T&).
+ */
+template <typename T>
+inline void keep(const T& value) {
+  asm volatile("" : : "r"(&value) : "memory");
+}
+
+//! Função chaves aleatórias
+/*!
+   Gera count chaves em [0, range) com semente fixa, para que todas as
+   execuções meçam a mesma sequência de operações.
+
+   \param count: Quantidade de chaves (size_t).
+   \param range: Limite superior (exclusivo) das chaves (size_t).
+   \return Vetor de chaves (std::vector<int>).
+ */
+std::vector<int> random_keys(std::size_t count, std::size_t range);
+
+//! Função permutação
+/*!
+   Gera os valores de 0 a size - 1 embaralhados, com semente fixa.
+
+   \param size: Quantidade de valores (size_t).
+   \param seed: Semente; sementes diferentes geram ordens diferentes (unsigned).
+   \return Vetor com a permutação (std::vector<int>).
+ */
+std::vector<int> permutation(std::size_t size, unsigned seed = 42u);
+
+//! Classe Suite
+/*!
+   Conjunto de medições de um módulo. Para cada tamanho de estrutura (1e2 a
+   1e7 por padrão), cada medição executa uma operação repetidas vezes e emite
+   uma linha com a vazão e os percentis de latência, em CSV ou JSON (um
+   objeto por linha), para que as saídas de vários módulos possam ser
+   concatenadas.
+
+   Opções de linha de comando:
+   - --format=csv|json: Formato da saída (padrão csv).
+   - --min-size=N e --max-size=N: Limites dos tamanhos medidos.
+   - --no-header: Omite o cabeçalho CSV.
+ */
+class Suite {
+ public:
+  //! Construtor
+  /*!
+     Lê as opções de linha de comando e, em CSV, emite o cabeçalho. Lança
+     exceção (invalid_argument) se uma opção for inválida.
+
+     \param argc: Quantidade de argumentos (int).
+     \param argv: Argumentos da linha de comando (char *[]).
+   */
+  Suite(int argc, char* argv[]);
+
+  //! Método tamanhos
+  /*!
+     Tamanhos de estrutura a medir, em potências de 10.
+
+     \return Tamanhos, em ordem crescente (const std::vector<size_t>&).
+   */
+  const std::vector<std::size_t>& sizes(void) const;
+
+  //! Método quantidade de operações
+  /*!
+     Quantidade de operações a medir em uma estrutura de tamanho size.
+     Operações de custo constante ou logarítmico são medidas size vezes;
+     operações lineares são limitadas para que cada medição visite cerca de
+     LINEAR_WORK elementos.
+
+     \param size: Tamanho da estrutura (size_t).
+     \param cost: Complexidade da operação (Cost).
+     \return Quantidade de operações (size_t).
+   */
+  std::size_t operations(std::size_t size, Cost cost) const;
+
+  //! Método mede
+  /*!
+     Executa run(i) para i de 0 a operations - 1 e emite o resultado. A vazão
+     considera todas as execuções; a latência de até MAX_SAMPLES execuções,
+     igualmente espaçadas, é medida individualmente para os percentis. O custo
+     de ler o relógio é descontado de ambas.
+
+     \param container: Nome da estrutura (const char *).
+     \param operation: Nome da operação (const char *).
+     \param size: Tamanho da estrutura (size_t).
+     \param operations: Quantidade de execuções (size_t).
+     \param run: Operação; recebe o índice da execução (F).
+   */
+  template <typename F>
+  void measure(const char* container, const char* operation, std::size_t size,
+               std::size_t operations, F run) {
+    std::vector<double> samples;
+    std::size_t stride = operations / MAX_SAMPLES + 1;
+    samples.reserve(operations / stride + 1);
+
+    std::size_t countdown = 0;
+    auto start = Clock::now();
+    for (std::size_t i = 0; i != operations; i++) {
+      if (countdown == 0) {
+        auto before = Clock::now();
+        run(i);
+        std::chrono::duration<double, std::nano> latency =
+            Clock::now() - before;
+        samples.push_back(std::max(latency.count() - clock_cost_, 0.0));
+        countdown = stride;
+      } else {
+        run(i);
+      }
+      countdown--;
+    }
+    std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+    // Cada latência medida leu o relógio duas vezes a mais.
+    double overhead = 2 * clock_cost_ * samples.size();
+    report(container, operation, size, operations,
+           std::max(elapsed.count() - overhead, 0.0), samples);
+  }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  //! Formato da saída
+  enum Format { CSV, JSON };
+
+  //! Método privado emite
+  /*!
+     Calcula os percentis de samples e emite uma linha de resultado.
+   */
+  void report(const char* container, const char* operation, std::size_t size,
+              std::size_t operations, double elapsed,
+              std::vector<double>& samples) const;
+
+  //! Tamanhos medidos
+  std::vector<std::size_t> sizes_;
+
+  //! Formato da saída
+  Format format_;
+
+  //! Custo, em nanossegundos, de uma leitura do relógio
+  double clock_cost_;
+
+  //! Máximo de latências individuais medidas por operação
+  static const auto MAX_SAMPLES = 100000u;
+
+  //! Elementos visitados por medição de operação linear
+  static const auto LINEAR_WORK = 100000000u;
+};
+}  // namespace benchmark
+
+#endif
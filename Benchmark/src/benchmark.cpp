@@ -0,0 +1,141 @@
+#include "benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+namespace {
+const std::size_t DEFAULT_MIN_SIZE = 100u;
+const std::size_t DEFAULT_MAX_SIZE = 10000000u;
+const std::size_t MIN_LINEAR_OPERATIONS = 10u;
+const unsigned SEED = 42u;
+const std::size_t CLOCK_READS = 1001u;
+
+std::size_t parse_size(const char* text) {
+  char* end = nullptr;
+  unsigned long long value = std::strtoull(text, &end, 10);
+  if (end == text || *end != '\0' || value == 0) {
+    throw std::invalid_argument(std::string("Invalid size: ") + text);
+  }
+  return value;
+}
+
+double percentile(const std::vector<double>& sorted, double fraction) {
+  if (sorted.empty()) {
+    return 0.0;
+  }
+  std::size_t rank = static_cast<std::size_t>(fraction * sorted.size());
+  return sorted[std::min(rank, sorted.size() - 1)];
+}
+
+double clock_cost(void) {
+  using Clock = std::chrono::steady_clock;
+  std::vector<double> costs(CLOCK_READS);
+  for (auto& cost : costs) {
+    auto before = Clock::now();
+    std::chrono::duration<double, std::nano> elapsed = Clock::now() - before;
+    cost = elapsed.count();
+  }
+  std::sort(costs.begin(), costs.end());
+  return percentile(costs, 0.50);
+}
+}  // namespace
+
+std::vector<int> benchmark::random_keys(std::size_t count,
+                                        std::size_t range) {
+  std::mt19937 generator{SEED};
+  std::uniform_int_distribution<std::size_t> distribution{0, range - 1};
+  std::vector<int> keys(count);
+  for (auto& key : keys) {
+    key = static_cast<int>(distribution(generator));
+  }
+  return keys;
+}
+
+std::vector<int> benchmark::permutation(std::size_t size, unsigned seed) {
+  std::vector<int> values(size);
+  std::iota(values.begin(), values.end(), 0);
+  std::shuffle(values.begin(), values.end(), std::mt19937{seed});
+  return values;
+}
+
+benchmark::Suite::Suite(int argc, char* argv[]) {
+  std::size_t min_size = DEFAULT_MIN_SIZE;
+  std::size_t max_size = DEFAULT_MAX_SIZE;
+  bool header = true;
+  format_ = CSV;
+  clock_cost_ = clock_cost();
+
+  for (int i = 1; i < argc; i++) {
+    const char* argument = argv[i];
+    if (std::strcmp(argument, "--format=csv") == 0) {
+      format_ = CSV;
+    } else if (std::strcmp(argument, "--format=json") == 0) {
+      format_ = JSON;
+    } else if (std::strncmp(argument, "--min-size=", 11) == 0) {
+      min_size = parse_size(argument + 11);
+    } else if (std::strncmp(argument, "--max-size=", 11) == 0) {
+      max_size = parse_size(argument + 11);
+    } else if (std::strcmp(argument, "--no-header") == 0) {
+      header = false;
+    } else {
+      throw std::invalid_argument(std::string("Unknown option: ") + argument);
+    }
+  }
+
+  for (std::size_t size = DEFAULT_MIN_SIZE; size <= max_size; size *= 10) {
+    if (size >= min_size) {
+      sizes_.push_back(size);
+    }
+  }
+
+  if (format_ == CSV && header) {
+    std::printf(
+        "container,operation,size,operations,ns_per_op,ops_per_sec,p50_ns,"
+        "p90_ns,p99_ns,max_ns\n");
+  }
+}
+
+const std::vector<std::size_t>& benchmark::Suite::sizes(void) const {
+  return sizes_;
+}
+
+std::size_t benchmark::Suite::operations(std::size_t size, Cost cost) const {
+  if (cost != LINEAR) {
+    return size;
+  }
+  std::size_t operations = LINEAR_WORK / size;
+  return std::min(size, std::max(operations, MIN_LINEAR_OPERATIONS));
+}
+
+void benchmark::Suite::report(const char* container, const char* operation,
+                              std::size_t size, std::size_t operations,
+                              double elapsed,
+                              std::vector<double>& samples) const {
+  std::sort(samples.begin(), samples.end());
+  double ns_per_op = operations == 0 ? 0.0 : elapsed / operations;
+  double ops_per_sec = elapsed == 0.0 ? 0.0 : operations * 1e9 / elapsed;
+  double p50 = percentile(samples, 0.50);
+  double p90 = percentile(samples, 0.90);
+  double p99 = percentile(samples, 0.99);
+  double max = samples.empty() ? 0.0 : samples.back();
+
+  if (format_ == CSV) {
+    std::printf("%s,%s,%zu,%zu,%.2f,%.0f,%.0f,%.0f,%.0f,%.0f\n", container,
+                operation, size, operations, ns_per_op, ops_per_sec, p50, p90,
+                p99, max);
+  } else {
+    std::printf(
+        "{\"container\":\"%s\",\"operation\":\"%s\",\"size\":%zu,"
+        "\"operations\":%zu,\"ns_per_op\":%.2f,\"ops_per_sec\":%.0f,"
+        "\"p50_ns\":%.0f,\"p90_ns\":%.0f,\"p99_ns\":%.0f,\"max_ns\":%.0f}\n",
+        container, operation, size, operations, ns_per_op, ops_per_sec, p50,
+        p90, p99, max);
+  }
+  std::fflush(stdout);
+}
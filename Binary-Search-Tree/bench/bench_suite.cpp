@@ -0,0 +1,76 @@
+#include <vector>
+
+#include "benchmark.h"
+#include "binary_search_tree.h"
+
+// Suíte de desempenho da BinaryTree (ver benchmark::Suite). Para cada tamanho:
+// insert (chaves em ordem aleatória), lookup (contains de chaves aleatórias),
+// first_k (os FIRST_K menores pelo iterador), first_k_snapshot (os mesmos
+// lidos de in_order()), traverse (percurso em-ordem completo pelo iterador),
+// traverse_snapshot (o mesmo sobre in_order()) e remove (chaves em outra ordem
+// aleatória).
+
+namespace {
+const std::size_t FIRST_K = 10u;
+}
+
+int main(int argc, char* argv[]) {
+  benchmark::Suite suite{argc, argv};
+  for (auto size : suite.sizes()) {
+    structures::BinaryTree<int> tree;
+    std::vector<int> keys = benchmark::permutation(size);
+    suite.measure("BinaryTree", "insert", size, size,
+                  [&](std::size_t i) { tree.insert(keys[i]); });
+
+    std::vector<int> lookups = benchmark::random_keys(size, size);
+    suite.measure("BinaryTree", "lookup", size, size, [&](std::size_t i) {
+      benchmark::keep(tree.contains(lookups[i]));
+    });
+
+    suite.measure("BinaryTree", "first_k", size, size, [&](std::size_t) {
+      long sum = 0;
+      auto it = tree.begin();
+      for (std::size_t k = 0; k != FIRST_K; k++, ++it) {
+        sum += *it;
+      }
+      benchmark::keep(sum);
+    });
+
+    suite.measure("BinaryTree", "first_k_snapshot", size,
+                  suite.operations(size, benchmark::LINEAR),
+                  [&](std::size_t) {
+                    auto snapshot = tree.in_order();
+                    long sum = 0;
+                    for (std::size_t k = 0; k != FIRST_K; k++) {
+                      sum += snapshot[k];
+                    }
+                    benchmark::keep(sum);
+                  });
+
+    suite.measure("BinaryTree", "traverse", size,
+                  suite.operations(size, benchmark::LINEAR),
+                  [&](std::size_t) {
+                    long sum = 0;
+                    for (auto data : tree) {
+                      sum += data;
+                    }
+                    benchmark::keep(sum);
+                  });
+
+    suite.measure("BinaryTree", "traverse_snapshot", size,
+                  suite.operations(size, benchmark::LINEAR),
+                  [&](std::size_t) {
+                    auto snapshot = tree.in_order();
+                    long sum = 0;
+                    for (std::size_t k = 0; k != snapshot.size(); k++) {
+                      sum += snapshot[k];
+                    }
+                    benchmark::keep(sum);
+                  });
+
+    std::vector<int> removals = benchmark::permutation(size, 7u);
+    suite.measure("BinaryTree", "remove", size, size,
+                  [&](std::size_t i) { tree.remove(removals[i]); });
+  }
+  return 0;
+}
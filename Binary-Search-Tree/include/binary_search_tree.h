@@ -1,195 +1,187 @@
 #ifndef STRUCTURES_BINARY_TREE_H
 #define STRUCTURES_BINARY_TREE_H
 
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 #include "array_list.h"
+#include "node_arena.h"
 
 namespace structures {
 template <typename T>
 //! Árvore Binária
 /*!
-   Implementação da árvore binária de busca com percussos.
+   Implementação da árvore binária de busca com percussos. Os nodos vivem em
+   uma NodeArena da árvore e se ligam por índices de 32 bits.
  */
 class BinaryTree {
  private:
+  struct Node;
+  using Index = typename NodeArena<Node>::Index;
+  static constexpr Index NIL = NodeArena<Node>::NIL;
+
   struct Node {
     explicit Node(const T& data) : data_{data} {}
 
-    ~Node(void) {
-      delete left_child;
-      delete right_child;
-    }
+    template <typename... Args>
+    explicit Node(std::in_place_t, Args&&... args)
+        : data_(std::forward<Args>(args)...) {}
 
     T data_;
-    Node* left_child{nullptr};
-    Node* right_child{nullptr};
-
-    void insert(const T& data) {
-      if (data < data_) {
-        // Inserção à esquerda.
-        if (left_child == nullptr) {
-          // Se não houver filho à esquerda, penduramos o novo dado em um novo
-          // filho da esquerda.
-          left_child = new Node(data);
-          if (left_child == nullptr) throw std::out_of_range("Tree is full!");
-        } else {
-          // Se houver filho à esquerda, descemos nele e chamamos insert
-          // novamente.
-          left_child->insert(data);
-        }
-      } else {
-        // Inserção à direita.
-        if (right_child == nullptr) {
-          // Se não houver filho à direita, penduramos o novo dado em um novo
-          // filho da direita.
-          right_child = new Node(data);
-          if (right_child == nullptr) throw std::out_of_range("Tree is full!");
-        } else {
-          // Se houver filho à direita, descemos nele e chamamos insert
-          // novamente.
-          right_child->insert(data);
-        }
-      }
-    }
-
-    bool remove(const T& data) {
-      bool removed = false;
-
-      if (data < data_ && left_child != nullptr) {
-        left_child = remove(data, left_child, removed);
+    Index left_child{NIL};
+    Index right_child{NIL};
+  };
 
-      } else if (data > data_ && right_child != nullptr) {
-        right_child = remove(data, right_child, removed);
+  //! Inserir Nodo
+  /*!
+     Pendura um nodo já construído na árvore binária.
 
-      } else {
-        if (left_child != nullptr && right_child != nullptr) {
-          Node* tmp = right_child->minimun();
-          data_ = tmp->data_;
-          right_child = remove(data_, right_child, removed);
+     \param node: Nodo a ser inserido (Index).
+   */
+  void insert_node(Index node);
 
-        } else if (left_child != nullptr) {
-          Node* tmp = left_child;
+  //! Destruir Nodos
+  /*!
+     Libera todos os nodos. Se T tiver destrutor trivial, a arena é devolvida
+     de uma só vez, sem visitar os nodos. Caso contrário, os nodos são
+     destruídos antes, sem recursão: enquanto o nodo atual tem filho à
+     esquerda, uma rotação à direita o leva para cima; sem filho à esquerda, o
+     nodo é destruído e a descida segue pela direita.
+   */
+  void destroy(void);
 
-          data_ = tmp->data_;
-          left_child = tmp->left_child;
-          right_child = tmp->right_child;
+  //! Desfazer em Sequência
+  /*!
+     Reorganiza os nodos de node, por rotações e sem alocar, em uma sequência
+     em-ordem encadeada pelos filhos da direita.
 
-          tmp->left_child = nullptr;
-          tmp->right_child = nullptr;
+     \param node: Raiz da subárvore (Index).
+     \return Primeiro nodo da sequência (Index).
+   */
+  Index flatten(Index node);
 
-          delete tmp;
+  //! Construir Balanceada
+  /*!
+     Liga os count primeiros nodos de vine, uma sequência em-ordem encadeada
+     pelos filhos da direita, em uma árvore perfeitamente balanceada, e avança
+     vine para depois deles. A recursão tem profundidade log2(count).
 
-          removed = true;
-        } else if (right_child != nullptr) {
-          Node* tmp = right_child;
+     \param vine: Sequência de nodos (Index&).
+     \param count: Quantidade de nodos a ligar (size_t).
+     \return Raiz da árvore (Index).
+   */
+  Index build(Index& vine, std::size_t count);
 
-          data_ = tmp->data_;
-          left_child = tmp->left_child;
-          right_child = tmp->right_child;
+  //! Visitar Dado
+  /*!
+     Chama visit com data. Retorna false apenas se visit retornar um bool
+     falso, pedindo o fim do percurso.
+   */
+  template <typename Visitor>
+  static bool visit_data(Visitor& visit, const T& data) {
+    if constexpr (std::is_void_v<std::invoke_result_t<Visitor&, const T&>>) {
+      visit(data);
+      return true;
+    } else {
+      return static_cast<bool>(visit(data));
+    }
+  }
 
-          tmp->left_child = nullptr;
-          tmp->right_child = nullptr;
+  NodeArena<Node> arena_;
+  Index root{NIL};
+  std::size_t size_{0u};
 
-          delete tmp;
+ public:
+  //! Iterador Em-ordem
+  /*!
+     Iterador constante que percorre a árvore em-ordem sob demanda, sem copiar
+     os elementos. Guarda o caminho da raiz até o nodo atual, com os nodos
+     cujo elemento ainda não foi visitado: memória proporcional à altura da
+     árvore.
+   */
+  class const_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
 
-          removed = true;
-        }
-      }
-      return removed;
-    }
+    const_iterator(void) = default;
 
-    bool contains(const T& data) const {
-      if (data < data_) {
-        if (left_child == nullptr)
-          return false;
-        else
-          return left_child->contains(data);
+    reference operator*(void) const { return (*arena_)[path_.back()].data_; }
 
-      } else if (data > data_) {
-        if (right_child == nullptr)
-          return false;
-        else
-          return right_child->contains(data);
+    pointer operator->(void) const { return &(*arena_)[path_.back()].data_; }
 
-      } else {
-        return true;
-      }
+    const_iterator& operator++(void) {
+      Index node = (*arena_)[path_.back()].right_child;
+      path_.pop_back();
+      descend(node);
+      return *this;
     }
 
-    void pre_order(ArrayList<T>& array) const {
-      if (this != nullptr) {
-        array.push_back(data_);
-        left_child->pre_order(array);
-        right_child->pre_order(array);
-      }
+    const_iterator operator++(int) {
+      const_iterator previous = *this;
+      ++*this;
+      return previous;
     }
 
-    void in_order(ArrayList<T>& array) const {
-      if (this != nullptr) {
-        left_child->in_order(array);
-        array.push_back(data_);
-        right_child->in_order(array);
+    bool operator==(const const_iterator& other) const {
+      if (path_.empty() || other.path_.empty()) {
+        return path_.empty() == other.path_.empty();
       }
+      return path_.back() == other.path_.back();
     }
 
-    void post_order(ArrayList<T>& array) const {
-      if (this != nullptr) {
-        left_child->post_order(array);
-        right_child->post_order(array);
-        array.push_back(data_);
-      }
+    bool operator!=(const const_iterator& other) const {
+      return !(*this == other);
     }
 
    private:
+    friend class BinaryTree;
 
-    Node* minimun() {
-      if (left_child == nullptr) return this;
-
-      return left_child->minimun();
+    const_iterator(const NodeArena<Node>& arena, Index root) : arena_{&arena} {
+      descend(root);
     }
 
-    Node* remove(const T& data, Node* tree, bool& removed) {
-      removed = false;
-      if (tree == nullptr)
-        return tree;
-
-      if (data < tree->data_) {
-        tree->left_child = remove(data, tree->left_child, removed);
-        return tree;
-      }
-
-      if (data > tree->data_) {
-        tree->right_child = remove(data, tree->right_child, removed);
-        return tree;
+    //! Desce pela esquerda a partir de node, empilhando o caminho.
+    void descend(Index node) {
+      for (; node != NIL; node = (*arena_)[node].left_child) {
+        path_.push_back(node);
       }
-
-      if (tree->left_child != nullptr && tree->right_child) {
-        Node* tmp = tree->right_child->minimun();
-        tree->data_ = tmp->data_;
-        tree->right_child = remove(data, tree->right_child, removed);
-        return tree;
-      }
-
-      Node* tmp;
-      if (tree->right_child != nullptr)
-        tmp = tree->right_child;
-      else
-        tmp = tree->left_child;
-
-      tree->right_child = nullptr;
-      tree->left_child = nullptr;
-      delete tree;
-      removed = true;
-      return tmp;
     }
 
+    const NodeArena<Node>* arena_{nullptr};
+    std::vector<Index> path_;
   };
 
-  Node* root{nullptr};
-  std::size_t size_{0u};
+  BinaryTree(void) = default;
+
+  //! Construtor de Movimento
+  /*!
+     Cria uma árvore tomando para si os nodos de other, sem copiar os dados.
+     other fica vazia.
+
+     \param other: Árvore de origem (BinaryTree&&).
+   */
+  BinaryTree(BinaryTree&& other);
 
- public:
   ~BinaryTree(void);
 
+  //! Atribuição por Movimento
+  /*!
+     Libera os nodos atuais e toma para si os nodos de other, sem copiar os
+     dados. other fica vazia.
+
+     \param other: Árvore de origem (BinaryTree&&).
+     \return Referência para esta árvore (BinaryTree&).
+   */
+  BinaryTree& operator=(BinaryTree&& other);
+
   //! Inserir Dado
   /*!
      Insere dado na árvore binária.
@@ -198,6 +190,76 @@ class BinaryTree {
    */
   void insert(const T& data);
 
+  //! Inserir Dado (movimento)
+  /*!
+     Como insert(const T&), mas move o dado para o novo nodo em vez de
+     copiá-lo.
+
+     \param data: Dado a ser movido para a árvore (T&&).
+   */
+  void insert(T&& data);
+
+  //! Construir Dado
+  /*!
+     Constrói o dado diretamente em um novo nodo, repassando args ao construtor
+     de T, e o insere na árvore binária sem cópias nem movimentos.
+
+     \param args: Argumentos repassados ao construtor de T.
+   */
+  template <typename... Args>
+  void emplace(Args&&... args) {
+    insert_node(arena_.make(std::in_place, std::forward<Args>(args)...));
+  }
+
+  //! Construir de Sequência Ordenada
+  /*!
+     Cria uma árvore binária perfeitamente balanceada com os elementos de
+     [first, last), que devem estar em ordem crescente. Custa O(n): os nodos
+     são alocados em sequência, encadeados pelos filhos da direita, e então
+     ligados de uma só vez, sem buscas nem rotações. Lança exceção
+     (invalid_argument) se a sequência não estiver ordenada.
+
+     \param first: Início da sequência (Iterator).
+     \param last: Fim da sequência (Iterator).
+     \return Árvore com os elementos (BinaryTree).
+   */
+  template <typename Iterator>
+  static BinaryTree from_sorted(Iterator first, Iterator last) {
+    // Durante a leitura, a sequência fica pendurada na raiz, e a árvore
+    // libera os nodos se uma exceção for lançada.
+    BinaryTree tree;
+    Index* tail = &tree.root;
+    Index previous = NIL;
+    for (; first != last; ++first) {
+      Index node = tree.arena_.make(std::in_place, *first);
+      *tail = node;
+      tail = &tree.arena_[node].right_child;
+      ++tree.size_;
+      if (previous != NIL &&
+          tree.arena_[node].data_ < tree.arena_[previous].data_) {
+        throw std::invalid_argument("Sequence is not sorted");
+      }
+      previous = node;
+    }
+
+    Index vine = tree.root;
+    tree.root = tree.build(vine, tree.size_);
+    return tree;
+  }
+
+  //! Intercalar Árvores
+  /*!
+     Move todos os elementos de other para esta árvore, que fica perfeitamente
+     balanceada; other fica vazia. Custa O(n + m): os nodos das duas árvores
+     são desfeitos em sequências ordenadas, intercalados e religados, e os
+     dados de other são movidos para a arena desta árvore, reservada antes:
+     se a reserva lançar exceção, as duas árvores ficam como estavam. Se esta
+     árvore estiver vazia, apenas toma a arena de other.
+
+     \param other: Árvore de origem (BinaryTree&&).
+   */
+  void merge(BinaryTree&& other);
+
   //! Remover Dado
   /*!
      Remove (se existir) dado da árvore binária.
@@ -235,8 +297,8 @@ class BinaryTree {
 
   //! Pré-ordem
   /*!
-     Percorre a árvore utilizando o algoritmo pré-ordem. Retorna uma lista com
-     os elementos na ordem percorrida.
+     Percorre a árvore utilizando o algoritmo pré-ordem (visit_pre_order).
+     Retorna uma lista com os elementos na ordem percorrida.
 
      \return lista: Lista (ArrayList<T>) com os elementos na ordem em que foram
      percorridos.
@@ -245,8 +307,8 @@ class BinaryTree {
 
   //! Pós-ordem
   /*!
-     Percorre a árvore utilizando o algoritmo pós-ordem. Retorna uma lista com
-     os elementos na ordem percorrida.
+     Percorre a árvore utilizando o algoritmo pós-ordem (visit_post_order).
+     Retorna uma lista com os elementos na ordem percorrida.
 
      \return lista: Lista (ArrayList<T>) com os elementos na ordem em que foram
      percorridos.
@@ -255,16 +317,116 @@ class BinaryTree {
 
   //! Em-ordem
   /*!
-     Percorre a árvore utilizando o algoritmo em-ordem. Retorna uma lista com os
-     elementos na ordem percorrida.
+     Percorre a árvore utilizando o algoritmo em-ordem, com o iterador
+     const_iterator. Retorna uma lista com os elementos na ordem percorrida.
 
      \return lista: Lista (ArrayList<T>) com os elementos na ordem em que foram
      percorridos.
    */
   ArrayList<T> in_order(void) const;
 
+  //! Visitar Pré-ordem
+  /*!
+     Chama visit com cada elemento, em pré-ordem, sem montar uma lista: a
+     pilha explícita guarda no máximo um nodo pendente por nível da árvore.
+     Se visit retornar bool, false interrompe o percurso.
+
+     \param visit: Função chamada com cada elemento (const T&).
+   */
+  template <typename Visitor>
+  void visit_pre_order(Visitor&& visit) const {
+    std::vector<Index> stack;
+    if (root != NIL) {
+      stack.push_back(root);
+    }
+    while (!stack.empty()) {
+      const Node& node = arena_[stack.back()];
+      stack.pop_back();
+      if (!visit_data(visit, node.data_)) {
+        return;
+      }
+      // O filho da direita é empilhado antes para que o da esquerda saia
+      // antes.
+      if (node.right_child != NIL) {
+        stack.push_back(node.right_child);
+      }
+      if (node.left_child != NIL) {
+        stack.push_back(node.left_child);
+      }
+    }
+  }
+
+  //! Visitar Em-ordem
+  /*!
+     Chama visit com cada elemento, em-ordem, pelo const_iterator. Se visit
+     retornar bool, false interrompe o percurso.
+
+     \param visit: Função chamada com cada elemento (const T&).
+   */
+  template <typename Visitor>
+  void visit_in_order(Visitor&& visit) const {
+    for (const auto& data : *this) {
+      if (!visit_data(visit, data)) {
+        return;
+      }
+    }
+  }
+
+  //! Visitar Pós-ordem
+  /*!
+     Chama visit com cada elemento, em pós-ordem, sem montar uma lista: a
+     pilha explícita guarda apenas os ancestrais do nodo atual. Se visit
+     retornar bool, false interrompe o percurso.
+
+     \param visit: Função chamada com cada elemento (const T&).
+   */
+  template <typename Visitor>
+  void visit_post_order(Visitor&& visit) const {
+    std::vector<Index> stack;
+    Index node = root;
+    Index visited = NIL;
+    while (node != NIL || !stack.empty()) {
+      if (node != NIL) {
+        stack.push_back(node);
+        node = arena_[node].left_child;
+        continue;
+      }
+      // A subárvore esquerda do topo já foi percorrida; o topo só sai depois
+      // da direita.
+      Index top = stack.back();
+      if (arena_[top].right_child != NIL &&
+          arena_[top].right_child != visited) {
+        node = arena_[top].right_child;
+      } else {
+        if (!visit_data(visit, arena_[top].data_)) {
+          return;
+        }
+        visited = top;
+        stack.pop_back();
+      }
+    }
+  }
+
+  //! Início Em-ordem
+  /*!
+     Iterador para o menor elemento da árvore.
+
+     \return Iterador em-ordem (const_iterator).
+   */
+  const_iterator begin(void) const;
+
+  //! Fim Em-ordem
+  /*!
+     Iterador após o maior elemento da árvore.
+
+     \return Iterador em-ordem (const_iterator).
+   */
+  const_iterator end(void) const;
+
   // Aux method for testing
-  Node* get_root(void) const { return root; }
+  const Node* get_root(void) const {
+    return root == NIL ? nullptr : &arena_[root];
+  }
 };
 }  // namespace structures
 
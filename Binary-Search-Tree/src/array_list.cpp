@@ -1,10 +1,18 @@
 #include "../include/array_list.h"
 #include <stdio.h>
 
+#include <algorithm>
+#include <string>
+#include <utility>
+
+#include "../include/linear_find.h"
+#include "../include/relocate.h"
+
 template <typename T>
 structures::ArrayList<T>::ArrayList(void) {
   max_size_ = DEFAULT_MAX_SIZE;
   size_ = -1;
+  growable_ = false;
   contents = new T[max_size_];
 }
 
@@ -12,14 +20,50 @@ template <typename T>
 structures::ArrayList<T>::ArrayList(std::size_t max_size) {
   max_size_ = max_size;
   size_ = -1;
+  growable_ = false;
   contents = new T[max_size_];
 }
 
+template <typename T>
+structures::ArrayList<T>::ArrayList(std::size_t max_size, bool growable) {
+  max_size_ = max_size;
+  size_ = -1;
+  growable_ = growable;
+  contents = new T[max_size_];
+}
+
+template <typename T>
+structures::ArrayList<T>::ArrayList(ArrayList&& other) {
+  max_size_ = other.max_size_;
+  size_ = other.size_;
+  growable_ = other.growable_;
+  contents = other.contents;
+  other.max_size_ = 0;
+  other.size_ = -1;
+  other.contents = nullptr;
+}
+
 template <typename T>
 structures::ArrayList<T>::~ArrayList(void) {
   delete[] contents;
 }
 
+template <typename T>
+structures::ArrayList<T>& structures::ArrayList<T>::operator=(
+    ArrayList&& other) {
+  if (this != &other) {
+    delete[] contents;
+    max_size_ = other.max_size_;
+    size_ = other.size_;
+    growable_ = other.growable_;
+    contents = other.contents;
+    other.max_size_ = 0;
+    other.size_ = -1;
+    other.contents = nullptr;
+  }
+  return *this;
+}
+
 template <typename T>
 void structures::ArrayList<T>::clear(void) {
   size_ = -1;
@@ -27,55 +71,37 @@ void structures::ArrayList<T>::clear(void) {
 
 template <typename T>
 void structures::ArrayList<T>::push_back(const T& data) {
-  if (full()) {
-    throw std::out_of_range("Cannot push back on full list");
-  }
-  contents[++size_] = data;
+  emplace(size(), data);
+}
+
+template <typename T>
+void structures::ArrayList<T>::push_back(T&& data) {
+  emplace(size(), std::move(data));
 }
 
 template <typename T>
 void structures::ArrayList<T>::push_front(const T& data) {
-  if (full()) {
-    throw std::out_of_range("Cannot push front to a full list");
-  } else if (empty()) {
-    contents[++size_] = data;
-  } else {
-    move_backward(0);
-    size_++;
-    contents[0] = data;
-  }
+  emplace(0, data);
+}
+
+template <typename T>
+void structures::ArrayList<T>::push_front(T&& data) {
+  emplace(0, std::move(data));
 }
 
 template <typename T>
 void structures::ArrayList<T>::insert(const T& data, std::size_t index) {
-  if (full()) {
-    throw std::out_of_range("Cannot insert on full list");
-  } else if ((index < 0) || (index > size_ + 1)) {
-    throw std::out_of_range("Invalid index");
-  } else {
-    move_backward(index);
-    size_++;
-    contents[index] = data;
-  }
+  emplace(index, data);
+}
+
+template <typename T>
+void structures::ArrayList<T>::insert(T&& data, std::size_t index) {
+  emplace(index, std::move(data));
 }
 
 template <typename T>
 void structures::ArrayList<T>::insert_sorted(const T& data) {
-  if (full()) {
-    throw std::out_of_range("Cannot insert in full list");
-  } else if (empty()) {
-    contents[++size_] = data;
-  } else {
-    std::size_t index = 0;
-    while (index != size() && contents[index] < data) {
-      index++;
-    }
-    if (index == size()) {
-      push_back(data);
-    } else {
-      insert(data, index);
-    }
-  }
+  emplace(lower_bound(data), data);
 }
 
 template <typename T>
@@ -95,7 +121,7 @@ T structures::ArrayList<T>::pop(std::size_t index) {
   } else if (empty()) {
     throw std::out_of_range("Cannot pop from empty list");
   } else {
-    T data = contents[index];
+    T data = std::move(contents[index]);
     size_--;
     move_forward(index);
     return data;
@@ -136,14 +162,29 @@ std::size_t structures::ArrayList<T>::find(const T& data) const {
   if (empty()) {
     throw std::out_of_range("Cannot find an element in an empty list");
   }
-  std::size_t index = 0;
-  while (index <= size_ && !(data == contents[index])) {
-    index++;
+  return linear_find(contents, size(), data);
+}
+
+template <typename T>
+std::size_t structures::ArrayList<T>::lower_bound(const T& data) const {
+  return std::lower_bound(contents, contents + size(), data) - contents;
+}
+
+template <typename T>
+std::size_t structures::ArrayList<T>::upper_bound(const T& data) const {
+  return std::upper_bound(contents, contents + size(), data) - contents;
+}
+
+template <typename T>
+std::size_t structures::ArrayList<T>::find_sorted(const T& data) const {
+  if (empty()) {
+    throw std::out_of_range("Cannot find an element in an empty list");
   }
-  if (index > size_) {
-    return size_ + 1;
-  } else {
+  std::size_t index = lower_bound(data);
+  if (index != size() && contents[index] == data) {
     return index;
+  } else {
+    return size();
   }
 }
 
@@ -157,6 +198,25 @@ std::size_t structures::ArrayList<T>::max_size(void) const {
   return max_size_;
 }
 
+template <typename T>
+bool structures::ArrayList<T>::growable(void) const {
+  return growable_;
+}
+
+template <typename T>
+void structures::ArrayList<T>::reserve(std::size_t max_size) {
+  if (max_size > max_size_) {
+    reallocate(max_size);
+  }
+}
+
+template <typename T>
+void structures::ArrayList<T>::shrink_to_fit(void) {
+  if (size() != max_size_) {
+    reallocate(size());
+  }
+}
+
 template <typename T>
 T& structures::ArrayList<T>::at(std::size_t index) {
   if (index < 0 || index >= size_ + 1) {
@@ -185,17 +245,89 @@ const T& structures::ArrayList<T>::operator[](std::size_t index) const {
 
 template <typename T>
 void structures::ArrayList<T>::move_forward(std::size_t index) {
-  for (std::size_t i = index; i != size_ + 1; i++) {
-    contents[i] = contents[i + 1];
-  }
+  relocate_overlapping(contents + index, contents + index + 1, size() - index);
 }
 
 template <typename T>
 void structures::ArrayList<T>::move_backward(std::size_t index) {
-  for (std::size_t i = size_ + 1; i != index; i--) {
-    contents[i] = contents[i - 1];
+  relocate_overlapping(contents + index + 1, contents + index, size() - index);
+}
+
+template <typename T>
+T* structures::ArrayList<T>::data(void) {
+  return contents;
+}
+
+template <typename T>
+const T* structures::ArrayList<T>::data(void) const {
+  return contents;
+}
+
+template <typename T>
+typename structures::ArrayList<T>::iterator structures::ArrayList<T>::begin(
+    void) {
+  return contents;
+}
+
+template <typename T>
+typename structures::ArrayList<T>::iterator structures::ArrayList<T>::end(
+    void) {
+  return contents + size();
+}
+
+template <typename T>
+typename structures::ArrayList<T>::const_iterator
+structures::ArrayList<T>::begin(void) const {
+  return contents;
+}
+
+template <typename T>
+typename structures::ArrayList<T>::const_iterator
+structures::ArrayList<T>::end(void) const {
+  return contents + size();
+}
+
+template <typename T>
+typename structures::ArrayList<T>::const_iterator
+structures::ArrayList<T>::cbegin(void) const {
+  return contents;
+}
+
+template <typename T>
+typename structures::ArrayList<T>::const_iterator
+structures::ArrayList<T>::cend(void) const {
+  return contents + size();
+}
+
+template <typename T>
+T& structures::ArrayList<T>::open(std::size_t index) {
+  if (index > size()) {
+    throw std::out_of_range("Invalid index");
+  } else if (!make_room()) {
+    throw std::out_of_range("Cannot insert on full list");
+  }
+  move_backward(index);
+  size_++;
+  return contents[index];
+}
+
+template <typename T>
+bool structures::ArrayList<T>::make_room(void) {
+  if (full() && growable_) {
+    reallocate(max_size_ == 0 ? DEFAULT_MAX_SIZE : 2 * max_size_);
   }
+  return !full();
+}
+
+template <typename T>
+void structures::ArrayList<T>::reallocate(std::size_t max_size) {
+  T* new_contents = new T[max_size];
+  relocate(new_contents, contents, size());
+  delete[] contents;
+  contents = new_contents;
+  max_size_ = max_size;
 }
 
 template class structures::ArrayList<int>;
 template class structures::ArrayList<char*>;
+template class structures::ArrayList<std::string>;
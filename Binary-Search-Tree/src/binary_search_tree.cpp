@@ -1,43 +1,215 @@
-#include "../include/binary_tree.h"
+#include "../include/binary_search_tree.h"
+
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+template<typename T>
+structures::BinaryTree<T>::BinaryTree(BinaryTree&& other)
+    : arena_{std::move(other.arena_)} {
+  root = other.root;
+  size_ = other.size_;
+  other.root = NIL;
+  other.size_ = 0u;
+}
 
 template<typename T>
 structures::BinaryTree<T>::~BinaryTree(void) {
-  delete root;
+  destroy();
+}
+
+template<typename T>
+structures::BinaryTree<T>& structures::BinaryTree<T>::operator=(
+    BinaryTree&& other) {
+  if (this != &other) {
+    destroy();
+    arena_ = std::move(other.arena_);
+    root = other.root;
+    size_ = other.size_;
+    other.root = NIL;
+    other.size_ = 0u;
+  }
+  return *this;
 }
 
 template<typename T>
 void structures::BinaryTree<T>::insert(const T& data) {
-  if (empty())
-    root = new Node(data);
-  else
-    root->insert(data);
+  emplace(data);
+}
+
+template<typename T>
+void structures::BinaryTree<T>::insert(T&& data) {
+  emplace(std::move(data));
+}
+
+template<typename T>
+void structures::BinaryTree<T>::insert_node(Index node) {
+  // Desce pelas ligações de filho até a nula onde o nodo é pendurado.
+  const T& data = arena_[node].data_;
+  Index* link = &root;
+  while (*link != NIL) {
+    Node& parent = arena_[*link];
+    if (data < parent.data_)
+      link = &parent.left_child;
+    else
+      link = &parent.right_child;
+  }
+  *link = node;
 
   size_++;
 }
 
+template<typename T>
+void structures::BinaryTree<T>::destroy(void) {
+  if (!std::is_trivially_destructible<T>::value) {
+    Index node = root;
+    while (node != NIL) {
+      Node& current = arena_[node];
+      if (current.left_child != NIL) {
+        Index left = current.left_child;
+        current.left_child = arena_[left].right_child;
+        arena_[left].right_child = node;
+        node = left;
+      } else {
+        Index right = current.right_child;
+        arena_.destroy(node);
+        node = right;
+      }
+    }
+  }
+  arena_.clear();
+  root = NIL;
+  size_ = 0u;
+}
+
+template<typename T>
+void structures::BinaryTree<T>::merge(BinaryTree&& other) {
+  if (this == &other || other.empty())
+    return;
+  if (empty()) {
+    *this = std::move(other);
+    return;
+  }
+
+  // Reserva antes de desfazer as árvores: os nodos de other são criados
+  // nesta arena sem alocar, e uma falha de alocação deixa as duas intactas.
+  arena_.reserve(other.size_);
+  Index left = flatten(root);
+  Index right = other.flatten(other.root);
+  other.root = NIL;
+  Index vine = NIL;
+  Index* tail = &vine;
+  while (left != NIL || right != NIL) {
+    // Em empates, os elementos desta árvore vêm antes.
+    if (right == NIL ||
+        (left != NIL && !(other.arena_[right].data_ < arena_[left].data_))) {
+      *tail = left;
+      left = arena_[left].right_child;
+    } else {
+      Index taken = right;
+      Node& moved = other.arena_[taken];
+      *tail = arena_.make(std::in_place, std::move(moved.data_));
+      right = moved.right_child;
+      other.arena_.destroy(taken);
+    }
+    tail = &arena_[*tail].right_child;
+  }
+
+  size_ += other.size_;
+  root = build(vine, size_);
+  other.size_ = 0u;
+  other.arena_.clear();
+}
+
+template<typename T>
+typename structures::BinaryTree<T>::Index structures::BinaryTree<T>::flatten(
+    Index node) {
+  Index vine = NIL;
+  Index* tail = &vine;
+  while (node != NIL) {
+    Node& current = arena_[node];
+    if (current.left_child != NIL) {
+      Index left = current.left_child;
+      current.left_child = arena_[left].right_child;
+      arena_[left].right_child = node;
+      node = left;
+    } else {
+      *tail = node;
+      tail = &current.right_child;
+      node = current.right_child;
+    }
+  }
+  return vine;
+}
+
+template<typename T>
+typename structures::BinaryTree<T>::Index structures::BinaryTree<T>::build(
+    Index& vine, std::size_t count) {
+  if (count == 0u)
+    return NIL;
+
+  Index left = build(vine, count / 2);
+  Index node = vine;
+  vine = arena_[node].right_child;
+  arena_[node].left_child = left;
+  arena_[node].right_child = build(vine, count - count / 2 - 1);
+  return node;
+}
+
 template<typename T>
 void structures::BinaryTree<T>::remove(const T& data) {
   if (empty())
     throw std::out_of_range("Cannot remove from empty tree");
 
-  if (size() != 1u) {
-    if (root->remove(data))
-      size_--;
-  } else {
-    if (root->data_ == data) {
-      delete root;
-      root = nullptr;
-      size_--;
-    }
+  Index* link = &root;
+  while (*link != NIL) {
+    Node& current = arena_[*link];
+    if (data < current.data_)
+      link = &current.left_child;
+    else if (data > current.data_)
+      link = &current.right_child;
+    else
+      break;
   }
+  if (*link == NIL)
+    return;
+
+  Index node = *link;
+  if (arena_[node].left_child != NIL && arena_[node].right_child != NIL) {
+    // Dois filhos: o sucessor (menor da subárvore direita) toma o lugar do
+    // dado removido, e é o nodo do sucessor que sai da árvore.
+    Index* successor = &arena_[node].right_child;
+    while (arena_[*successor].left_child != NIL)
+      successor = &arena_[*successor].left_child;
+
+    arena_[node].data_ = std::move(arena_[*successor].data_);
+    link = successor;
+    node = *link;
+  }
+
+  if (arena_[node].left_child != NIL)
+    *link = arena_[node].left_child;
+  else
+    *link = arena_[node].right_child;
+
+  arena_.destroy(node);
+  size_--;
 }
 
 template<typename T>
 bool structures::BinaryTree<T>::contains(const T& data) const {
-  if (empty())
-    return false;
-
-  return root->contains(data);
+  Index node = root;
+  while (node != NIL) {
+    const Node& current = arena_[node];
+    if (data < current.data_)
+      node = current.left_child;
+    else if (data > current.data_)
+      node = current.right_child;
+    else
+      return true;
+  }
+  return false;
 }
 
 template<typename T>
@@ -53,8 +225,7 @@ std::size_t structures::BinaryTree<T>::size(void) const {
 template<typename T>
 structures::ArrayList<T> structures::BinaryTree<T>::pre_order(void) const {
   structures::ArrayList<T> array{size_};
-  if (!empty())
-    root->pre_order(array);
+  visit_pre_order([&array](const T& data) { array.push_back(data); });
 
   return array;
 }
@@ -62,8 +233,8 @@ structures::ArrayList<T> structures::BinaryTree<T>::pre_order(void) const {
 template<typename T>
 structures::ArrayList<T> structures::BinaryTree<T>::in_order(void) const {
   structures::ArrayList<T> array{size_};
-  if (!empty())
-    root->in_order(array);
+  for (const auto& data : *this)
+    array.push_back(data);
 
   return array;
 }
@@ -71,10 +242,22 @@ structures::ArrayList<T> structures::BinaryTree<T>::in_order(void) const {
 template<typename T>
 structures::ArrayList<T> structures::BinaryTree<T>::post_order(void) const {
   structures::ArrayList<T> array{size_};
-  if (!empty())
-    root->post_order(array);
+  visit_post_order([&array](const T& data) { array.push_back(data); });
 
   return array;
 }
 
+template<typename T>
+typename structures::BinaryTree<T>::const_iterator
+structures::BinaryTree<T>::begin(void) const {
+  return const_iterator{arena_, root};
+}
+
+template<typename T>
+typename structures::BinaryTree<T>::const_iterator
+structures::BinaryTree<T>::end(void) const {
+  return const_iterator{};
+}
+
 template class structures::BinaryTree<int>;
+template class structures::BinaryTree<std::string>;
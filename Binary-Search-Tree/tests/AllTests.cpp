@@ -1,9 +1,40 @@
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "../include/array_list.h"
-#include "../include/binary_tree.h"
+#include "../include/binary_search_tree.h"
 #include "gtest/gtest.h"
 
+namespace {
+//! Alocações até o operator new lançar bad_alloc; negativo, nenhuma falha
+long allocations_left = -1;
+
+//! Fora de linha: expandido junto de um new, o std::free acusaria
+//! -Wmismatched-new-delete.
+__attribute__((noinline)) void release(void* pointer) { std::free(pointer); }
+}  // namespace
+
+void* operator new(std::size_t size) {
+  if (allocations_left == 0) {
+    throw std::bad_alloc();
+  } else if (allocations_left > 0) {
+    allocations_left--;
+  }
+  void* pointer = std::malloc(size == 0 ? 1 : size);
+  if (pointer == nullptr) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+void operator delete(void* pointer) noexcept { release(pointer); }
+
+void operator delete(void* pointer, std::size_t) noexcept { release(pointer); }
+
 int main(int argc, char* argv[]) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -166,3 +197,230 @@ TEST_F(BinaryTreeTest, RemoveDeletesData) {
   ASSERT_FALSE(tree.contains(6));
   ASSERT_FALSE(tree.contains(8));
 }
+
+// Test Move
+TEST_F(BinaryTreeTest, MoveAssignmentTakesNodes) {
+  structures::BinaryTree<int> other{};
+  other.insert(5);
+  other.insert(3);
+  other.insert(7);
+  tree.insert(1);
+
+  tree = std::move(other);
+
+  ASSERT_EQ(3u, tree.size());
+  ASSERT_TRUE(tree.contains(3));
+  ASSERT_FALSE(tree.contains(1));
+  ASSERT_TRUE(other.empty());
+  ASSERT_EQ(other.get_root(), nullptr);
+}
+
+TEST_F(BinaryTreeTest, InsertRvalueAndEmplaceStrings) {
+  structures::BinaryTree<std::string> strings{};
+  std::string moved(64, 'm');
+  strings.insert(std::move(moved));
+  strings.emplace(3u, 'z');
+  strings.emplace("a");
+
+  ASSERT_TRUE(moved.empty());
+  ASSERT_EQ(3u, strings.size());
+  ASSERT_TRUE(strings.contains(std::string(64, 'm')));
+  auto in_order = strings.in_order();
+  ASSERT_EQ("a", in_order[0]);
+  ASSERT_EQ("zzz", in_order[2]);
+}
+
+// Test Iterative Traversals
+TEST_F(BinaryTreeTest, DegenerateTreeDoesNotOverflowTheStack) {
+  // Chaves em ordem formam uma lista à direita: recursão estouraria a pilha.
+  const int count = 30000;
+  for (auto i = 0; i < count; i++) {
+    tree.insert(i);
+  }
+
+  auto pre = tree.pre_order();
+  auto in = tree.in_order();
+  auto post = tree.post_order();
+  for (auto i = 0; i < count; i++) {
+    ASSERT_EQ(pre[i], i);
+    ASSERT_EQ(in[i], i);
+    ASSERT_EQ(post[i], count - 1 - i);
+  }
+  ASSERT_TRUE(tree.contains(count - 1));
+  tree.remove(0);
+  ASSERT_EQ(tree.size(), count - 1u);
+}
+
+TEST_F(BinaryTreeTest, IteratorVisitsInOrder) {
+  ASSERT_TRUE(tree.begin() == tree.end());
+  for (auto data : {5, 3, 7, 2, 1, 6, 8, 4}) {
+    tree.insert(data);
+  }
+
+  auto expected = 1;
+  for (const auto& data : tree) {
+    ASSERT_EQ(data, expected++);
+  }
+  ASSERT_EQ(expected, 9);
+
+  // Parar cedo não percorre o resto da árvore.
+  auto it = tree.begin();
+  ASSERT_EQ(*it++, 1);
+  ASSERT_EQ(*++it, 3);
+}
+
+TEST_F(BinaryTreeTest, RemoveMissingDataKeepsTree) {
+  tree.insert(5);
+  tree.insert(7);
+  tree.remove(3);
+  tree.remove(9);
+
+  ASSERT_EQ(tree.size(), 2u);
+  ASSERT_TRUE(tree.contains(5));
+  ASSERT_TRUE(tree.contains(7));
+}
+
+TEST_F(BinaryTreeTest, VisitorsMatchTraversals) {
+  for (auto data : {5, 3, 7, 2, 1, 6, 8, 4}) {
+    tree.insert(data);
+  }
+
+  auto pre = tree.pre_order();
+  auto in = tree.in_order();
+  auto post = tree.post_order();
+  std::size_t i = 0;
+  tree.visit_pre_order([&](int data) { ASSERT_EQ(data, pre[i++]); });
+  ASSERT_EQ(i, tree.size());
+  i = 0;
+  tree.visit_in_order([&](int data) { ASSERT_EQ(data, in[i++]); });
+  ASSERT_EQ(i, tree.size());
+  i = 0;
+  tree.visit_post_order([&](int data) { ASSERT_EQ(data, post[i++]); });
+  ASSERT_EQ(i, tree.size());
+}
+
+TEST_F(BinaryTreeTest, VisitorReturningFalseStops) {
+  for (auto data : {5, 3, 7, 2, 1, 6, 8, 4}) {
+    tree.insert(data);
+  }
+
+  std::vector<int> visited;
+  auto first_three = [&](int data) {
+    visited.push_back(data);
+    return visited.size() < 3u;
+  };
+  tree.visit_pre_order(first_three);
+  ASSERT_EQ(visited, (std::vector<int>{5, 3, 2}));
+  visited.clear();
+  tree.visit_in_order(first_three);
+  ASSERT_EQ(visited, (std::vector<int>{1, 2, 3}));
+  visited.clear();
+  tree.visit_post_order(first_three);
+  ASSERT_EQ(visited, (std::vector<int>{1, 2, 4}));
+}
+
+// Test Bulk Construction
+TEST_F(BinaryTreeTest, FromSortedBuildsBalancedTree) {
+  std::vector<int> values{1, 2, 3, 4, 5, 6, 7};
+  tree = structures::BinaryTree<int>::from_sorted(values.begin(),
+                                                  values.end());
+
+  ASSERT_EQ(tree.size(), 7u);
+  auto pre = tree.pre_order();
+  std::vector<int> expected{4, 2, 1, 3, 6, 5, 7};
+  for (std::size_t i = 0; i < expected.size(); i++) {
+    ASSERT_EQ(pre[i], expected[i]);
+  }
+  tree.insert(0);
+  ASSERT_TRUE(tree.contains(0));
+  ASSERT_TRUE(tree.contains(7));
+}
+
+TEST_F(BinaryTreeTest, FromSortedThrowsErrorWhenUnsorted) {
+  std::vector<std::string> values{"a", "c", "b"};
+  ASSERT_THROW(structures::BinaryTree<std::string>::from_sorted(
+                   values.begin(), values.end()),
+               std::invalid_argument);
+
+  auto empty = structures::BinaryTree<std::string>::from_sorted(
+      values.begin(), values.begin());
+  ASSERT_TRUE(empty.empty());
+}
+
+TEST_F(BinaryTreeTest, MergeInterleavesBothTrees) {
+  structures::BinaryTree<int> other{};
+  for (auto i = 0; i < 100; i++) {
+    tree.insert(2 * i);
+    other.insert(2 * i + 1);
+  }
+  other.insert(0);
+
+  tree.merge(std::move(other));
+  ASSERT_TRUE(other.empty());
+  ASSERT_EQ(other.get_root(), nullptr);
+  ASSERT_EQ(tree.size(), 201u);
+
+  auto in = tree.in_order();
+  ASSERT_EQ(in[0], 0);
+  ASSERT_EQ(in[1], 0);
+  for (auto i = 1; i < 200; i++) {
+    ASSERT_EQ(in[i + 1], i);
+  }
+  tree.merge(std::move(other));
+  ASSERT_EQ(tree.size(), 201u);
+}
+
+TEST_F(BinaryTreeTest, MergeMovesStringsBetweenArenas) {
+  structures::BinaryTree<std::string> strings{};
+  structures::BinaryTree<std::string> other{};
+  for (auto i = 0; i < 200; i++) {
+    strings.emplace(32u, static_cast<char>('a' + i % 26));
+    other.emplace(std::to_string(i));
+  }
+  for (auto i = 0; i < 100; i++) {
+    other.remove(std::to_string(i));
+    other.insert(std::to_string(i) + "!");
+  }
+
+  strings.merge(std::move(other));
+  ASSERT_TRUE(other.empty());
+  ASSERT_EQ(strings.size(), 400u);
+  ASSERT_TRUE(strings.contains("99!"));
+  ASSERT_TRUE(strings.contains("199"));
+  ASSERT_FALSE(strings.contains("99"));
+  ASSERT_TRUE(strings.contains(std::string(32u, 'z')));
+}
+
+TEST_F(BinaryTreeTest, MergeFailingAllocationKeepsBothTrees) {
+  for (auto fail_at = 0;; fail_at++) {
+    structures::BinaryTree<std::string> strings{};
+    structures::BinaryTree<std::string> other{};
+    for (auto i = 0; i < 100; i++) {
+      strings.insert(std::to_string(2 * i));
+    }
+    for (auto i = 0; i < 300; i++) {
+      other.insert(std::to_string(2 * i + 1));
+    }
+
+    allocations_left = fail_at;
+    try {
+      strings.merge(std::move(other));
+    } catch (const std::bad_alloc&) {
+      allocations_left = -1;
+      ASSERT_EQ(strings.size(), 100u);
+      ASSERT_EQ(other.size(), 300u);
+      ASSERT_EQ(strings.in_order().size(), 100u);
+      ASSERT_EQ(other.in_order().size(), 300u);
+      ASSERT_TRUE(strings.contains("198"));
+      ASSERT_TRUE(other.contains("599"));
+      continue;
+    }
+    allocations_left = -1;
+    ASSERT_LT(0, fail_at);
+    ASSERT_TRUE(other.empty());
+    ASSERT_EQ(strings.size(), 400u);
+    ASSERT_EQ(strings.in_order().size(), 400u);
+    ASSERT_TRUE(strings.contains("599"));
+    break;
+  }
+}
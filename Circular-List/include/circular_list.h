@@ -2,10 +2,15 @@
 #define STRUCTURES_CIRCULAR_LIST_H
 
 #include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "pool_allocator.h"
 
 namespace structures {
 
-template <typename T>
+template <typename T, typename Allocator = PoolAllocator<T>>
 //! Classe CircularList
 /*!
    Classe lista circular encadeada.
@@ -14,9 +19,17 @@ class CircularList {
  public:
   //! Construtor
   /*!
-     Construtor da classe lista circular encadeada.
+     Construtor da classe lista circular encadeada. Não aloca memória.
+   */
+  CircularList(void) noexcept;
+
+  //! Construtor de movimento
+  /*!
+     Cria uma lista tomando para si os nodos de other, sem copiar os dados.
+     other fica vazia.
+     \param other: Lista de origem (CircularList&&).
    */
-  CircularList(void);
+  CircularList(CircularList&& other);
 
   //! Destrutor
   /*!
@@ -24,6 +37,15 @@ class CircularList {
    */
   ~CircularList(void);
 
+  //! Atribuição por movimento
+  /*!
+     Remove os elementos atuais e toma para si os nodos de other, sem copiar os
+     dados. other fica vazia.
+     \param other: Lista de origem (CircularList&&).
+     \return Referência para esta lista (CircularList&).
+   */
+  CircularList& operator=(CircularList&& other);
+
   //! Método limpa
   /*!
      Limpa a lista.
@@ -39,6 +61,26 @@ class CircularList {
    */
   void push_back(const T& data);
 
+  //! Método adiciona no fim da lista (movimento)
+  /*!
+     Como push_back(const T&), mas move data para o novo nodo em vez de
+     copiá-lo.
+     \param data: Elemento a ser movido para a lista (T&&).
+   */
+  void push_back(T&& data);
+
+  //! Método constrói no fim da lista
+  /*!
+     Constrói o elemento diretamente em um novo nodo no fim da lista,
+     repassando args ao construtor de T, sem cópias nem movimentos.
+     \param args: Argumentos repassados ao construtor de T.
+     \return Referência ao elemento adicionado (T&).
+   */
+  template <typename... Args>
+  T& emplace_back(Args&&... args) {
+    return emplace(size_, std::forward<Args>(args)...);
+  }
+
   //! Método adiciona no início da lista
   /*!
      Adiciona elemento (data) no início da lista, se houver espaço. Se não
@@ -48,6 +90,25 @@ class CircularList {
    */
   void push_front(const T& data);
 
+  //! Método adiciona no início da lista (movimento)
+  /*!
+     Como push_front(const T&), mas move data para o novo nodo em vez de
+     copiá-lo.
+     \param data: Elemento a ser movido para a lista (T&&).
+   */
+  void push_front(T&& data);
+
+  //! Método constrói no início da lista
+  /*!
+     Como emplace_back, mas adiciona o elemento no início da lista.
+     \param args: Argumentos repassados ao construtor de T.
+     \return Referência ao elemento adicionado (T&).
+   */
+  template <typename... Args>
+  T& emplace_front(Args&&... args) {
+    return emplace(0u, std::forward<Args>(args)...);
+  }
+
   //! Método insere na posição
   /*!
      Insere elemento (data) em uma dada posição da lista (index), se houver
@@ -58,6 +119,33 @@ class CircularList {
    */
   void insert(const T& data, std::size_t index);
 
+  //! Método insere na posição (movimento)
+  /*!
+     Como insert(const T&, size_t), mas move data para o novo nodo em vez de
+     copiá-lo.
+     \param data: Elemento a ser movido para a lista (T&&).
+     \param index: Posição para inserir o elemento (size_t).
+   */
+  void insert(T&& data, std::size_t index);
+
+  //! Método constrói na posição
+  /*!
+     Como emplace_back, mas insere o elemento na posição index. Se a posição
+     não for válida, lança exceção (out_of_range) sem construir o elemento.
+     \param index: Posição para inserir o elemento (size_t).
+     \param args: Argumentos repassados ao construtor de T.
+     \return Referência ao elemento inserido (T&).
+   */
+  template <typename... Args>
+  T& emplace(std::size_t index, Args&&... args) {
+    if (index > size_) {
+      throw std::out_of_range("Invalid index");
+    }
+    Node* new_node = make_node(std::forward<Args>(args)...);
+    insert_node(new_node, index);
+    return new_node->data();
+  }
+
   //! Método insere ordenado
   /*!
      Insere elemento (data) em ordem na lista (caso a lista possua ordem). Se
@@ -109,7 +197,7 @@ class CircularList {
      posição for válida. Se não há elementos ou a posição não é válida, lança
      exceção (out_of_range).
      \param index: Posição do elemento a ser removido (size_t).
-     \return Elemento removido (T)
+     \return Elemento removido, movido para fora do nodo (T).
    */
   T pop(std::size_t index);
 
@@ -117,7 +205,7 @@ class CircularList {
   /*!
      Remove elemento no final da lista, se houver elementos. Se não houver
      elementos, lança exceção (out_of_range).
-     \return Elemento removido (T).
+     \return Elemento removido, movido para fora do nodo (T).
    */
   T pop_back(void);
 
@@ -126,7 +214,7 @@ class CircularList {
      Remove elemento no início da lista e move os elementos restantes "um passo
      para frente", se houver elementos. Se não houver elementos, lança exceção
      (out_of_range).
-     \return Elemento removido (T)
+     \return Elemento removido, movido para fora do nodo (T).
    */
   T pop_front(void);
 
@@ -176,31 +264,105 @@ class CircularList {
   std::size_t size(void) const;
 
  private:
-  class Node {
+  //! Classe Link
+  /*!
+     Encadeamento de um nodo, sem o dado. O sentinela da lista é um Link
+     embutido nela, que aponta para si mesmo enquanto a lista está vazia.
+   */
+  class Link {
    public:
-    explicit Node(const T& data)
-        : data_{data}, next_{nullptr} {}
+    Link(void) : next_{this} {}
 
-    Node(const T& data, Node* next)
-        : data_{data}, next_{next} {}
+    Link* next(void) { return next_; }
 
-    T& data(void) { return data_; };
+    const Link* next(void) const { return next_; }
 
-    const T& data(void) const { return data_; }
+    void next(Link* link) { next_ = link; }
+
+   private:
+    Link* next_;
+  };
 
-    Node* next(void) { return next_; }
+  class Node : public Link {
+   public:
+    template <typename... Args>
+    explicit Node(std::in_place_t, Args&&... args)
+        : data_(std::forward<Args>(args)...) {}
 
-    const Node* next(void) const { return next_; }
+    T& data(void) { return data_; };
 
-    void next(Node* node) { next_ = node; }
+    const T& data(void) const { return data_; }
 
    private:
     T data_;
-    Node* next_{nullptr};
   };
 
-  Node* before_index(std::size_t index) {
-    Node * before = head_->next();
+  //! Método nodo do encadeamento
+  /*!
+     Converte um encadeamento que não é o sentinela no nodo que o contém.
+     \param link: Encadeamento de um nodo (Link *).
+     \return Nodo (Node *).
+   */
+  static Node* as_node(Link* link) { return static_cast<Node*>(link); }
+
+  static const Node* as_node(const Link* link) {
+    return static_cast<const Node*>(link);
+  }
+
+  //! Alocador de nodos
+  using NodeAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+
+  //! Operações do alocador de nodos
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+  //! Método cria nodo
+  /*!
+     Obtém um nodo do alocador e constrói nele o dado, repassando args ao
+     construtor de T. Se a construção lançar exceção, devolve o nodo ao
+     alocador.
+     \param args: Argumentos repassados ao construtor de T.
+     \return Nodo criado, ainda não encadeado (Node *).
+   */
+  template <typename... Args>
+  Node* make_node(Args&&... args) {
+    Node* node = NodeTraits::allocate(allocator_, 1);
+    try {
+      NodeTraits::construct(allocator_, node, std::in_place,
+                            std::forward<Args>(args)...);
+    } catch (...) {
+      NodeTraits::deallocate(allocator_, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  //! Método destrói nodo
+  /*!
+     Destrói o dado do nodo e devolve o nodo ao alocador.
+     \param node: Nodo já desencadeado (Node *).
+   */
+  void destroy_node(Node* node);
+
+  //! Método insere nodo
+  /*!
+     Encadeia um nodo já construído na posição index, que deve ser válida.
+     \param new_node: Nodo a ser inserido (Node *).
+     \param index: Posição do nodo na lista (size_t).
+   */
+  void insert_node(Node* new_node, std::size_t index);
+
+  //! Método toma nodos
+  /*!
+     Encadeia os nodos de other no sentinela desta lista, que deve estar
+     vazia, e deixa other vazia. Só o último nodo, que apontava para o
+     sentinela de other, é alterado.
+     \param other: Lista de origem (CircularList&).
+   */
+  void take_nodes(CircularList& other);
+
+  Link* before_index(std::size_t index) {
+    Link* before = head_.next();
 
     for (auto i = 1u; i < index; i++) {
       before = before->next();
@@ -211,15 +373,27 @@ class CircularList {
 
   //! Atributo privado Cabeça de Lista
   /*!
-     Aponta para o "nodo sentinela" da lista circular encadeada.
+     "Nodo sentinela" da lista circular encadeada, sem dado, embutido na
+     lista: uma lista vazia não aloca nada.
    */
-  Node* head_;
+  Link head_;
+
+  //! Atributo privado Cauda
+  /*!
+     Último nodo da lista, ou o sentinela se ela estiver vazia. Como o último
+     nodo aponta para o sentinela embutido, a cauda permite mover a lista em
+     tempo constante; também torna push_back constante.
+   */
+  Link* tail_{&head_};
 
   //! Atributo privado Tamanho
   /*!
      Armazena o tamanho da lista encadeada circular.
    */
   std::size_t size_;
+
+  //! Alocador dos nodos da lista
+  NodeAllocator allocator_;
 };
 
 }
@@ -1,85 +1,97 @@
 #include "circular_list.h"
 
+#include <memory>
 #include <stdexcept>
+#include <string>
+#include <utility>
 
-template <typename T>
-structures::CircularList<T>::CircularList(void) {
+template <typename T, typename Allocator>
+structures::CircularList<T, Allocator>::CircularList(void) noexcept {
   size_ = 0u;
-  head_ = new Node((T)0, nullptr);
-  head_->next(head_);
 }
 
-template <typename T>
-structures::CircularList<T>::~CircularList(void) {
+template <typename T, typename Allocator>
+structures::CircularList<T, Allocator>::CircularList(CircularList&& other)
+    : allocator_{std::move(other.allocator_)} {
+  size_ = 0u;
+  take_nodes(other);
+}
+
+template <typename T, typename Allocator>
+structures::CircularList<T, Allocator>::~CircularList(void) {
   clear();
 }
 
-template <typename T>
-void structures::CircularList<T>::clear(void) {
+template <typename T, typename Allocator>
+structures::CircularList<T, Allocator>&
+structures::CircularList<T, Allocator>::operator=(CircularList&& other) {
+  if (this != &other) {
+    clear();
+    allocator_ = std::move(other.allocator_);
+    take_nodes(other);
+  }
+  return *this;
+}
+
+template <typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::clear(void) {
   while (!empty()) {
     pop_front();
   }
 }
 
-template <typename T>
-std::size_t structures::CircularList<T>::size(void) const {
+template <typename T, typename Allocator>
+std::size_t structures::CircularList<T, Allocator>::size(void) const {
   return size_;
 }
 
-template <typename T>
-bool structures::CircularList<T>::empty(void) const {
+template <typename T, typename Allocator>
+bool structures::CircularList<T, Allocator>::empty(void) const {
   return size_ == 0;
 }
 
-template <typename T>
-void structures::CircularList<T>::push_back(const T& data) {
-  insert(data, size_);
+template <typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::push_back(const T& data) {
+  emplace_back(data);
 }
 
-template <typename T>
-void structures::CircularList<T>::push_front(const T& data) {
-  Node * new_node = new Node(data);
-
-  if (new_node == nullptr) {
-    throw std::out_of_range("Cannot push front. List is full");
-  }
-
-  new_node->next(head_->next());
-  head_->next(new_node);
-  size_++;
+template <typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::push_back(T&& data) {
+  emplace_back(std::move(data));
 }
 
-template <typename T>
-void structures::CircularList<T>::insert(const T& data, std::size_t index) {
-  if (index > size_) {
-    throw std::out_of_range("Invalid index");
-  }
+template <typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::push_front(const T& data) {
+  emplace_front(data);
+}
 
-  if (index == 0) {
-    push_front(data);
-  } else {
-    Node* before = before_index(index);
+template <typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::push_front(T&& data) {
+  emplace_front(std::move(data));
+}
 
-    Node* new_node = new Node(data, before->next());
-    if (new_node == nullptr) {
-      throw std::out_of_range("Full list");
-    }
+template <typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::insert(const T& data,
+                                                    std::size_t index) {
+  emplace(index, data);
+}
 
-    before->next(new_node);
-    size_++;
-  }
+template <typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::insert(T&& data,
+                                                    std::size_t index) {
+  emplace(index, std::move(data));
 }
 
-template <typename T>
-void structures::CircularList<T>::insert_sorted(const T& data) {
+template <typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::insert_sorted(const T& data) {
   if (empty()) {
     push_front(data);
   } else {
-    Node* current = head_->next();
+    Link* current = head_.next();
     std::size_t position = size_;
 
     for (auto index = 0; index < size_; index++) {
-      if (!(data > current->data())) {
+      if (!(data > as_node(current)->data())) {
         position = index;
         break;
       }
@@ -90,29 +102,32 @@ void structures::CircularList<T>::insert_sorted(const T& data) {
   }
 }
 
-template <typename T>
-T structures::CircularList<T>::pop_back(void) {
+template <typename T, typename Allocator>
+T structures::CircularList<T, Allocator>::pop_back(void) {
   return pop(size_ - 1u);
 }
 
-template <typename T>
-T structures::CircularList<T>::pop_front(void) {
+template <typename T, typename Allocator>
+T structures::CircularList<T, Allocator>::pop_front(void) {
   if (empty()) {
     throw std::out_of_range("Cannot pop_front from empty list");
   }
 
-  Node* out = head_->next();
-  T data = head_->next()->data();
+  Node* out = as_node(head_.next());
+  T data = std::move(out->data());
 
-  head_->next(out->next());
+  head_.next(out->next());
+  if (out == tail_) {
+    tail_ = &head_;
+  }
   size_--;
-  delete out;
+  destroy_node(out);
 
   return data;
 }
 
-template <typename T>
-T structures::CircularList<T>::pop(std::size_t index) {
+template <typename T, typename Allocator>
+T structures::CircularList<T, Allocator>::pop(std::size_t index) {
   if (empty()) {
     throw std::out_of_range("Empty list");
   }
@@ -124,38 +139,41 @@ T structures::CircularList<T>::pop(std::size_t index) {
     return pop_front();
   }
 
-  Node* before_out = before_index(index);
-  Node* out = before_out->next();
-  T data = out->data();
+  Link* before_out = before_index(index);
+  Node* out = as_node(before_out->next());
+  T data = std::move(out->data());
 
   before_out->next(out->next());
+  if (out == tail_) {
+    tail_ = before_out;
+  }
   size_--;
-  delete out;
+  destroy_node(out);
 
   return data;
 }
 
-template <typename T>
-void structures::CircularList<T>::remove(const T& data) {
+template <typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::remove(const T& data) {
   pop(find(data));
 }
 
-template <typename T>
-bool structures::CircularList<T>::contains(const T& data) const {
+template <typename T, typename Allocator>
+bool structures::CircularList<T, Allocator>::contains(const T& data) const {
   return find(data) != size();
 }
 
-template <typename T>
-std::size_t structures::CircularList<T>::find(const T& data) const {
+template <typename T, typename Allocator>
+std::size_t structures::CircularList<T, Allocator>::find(const T& data) const {
   if (empty()) {
     throw std::out_of_range("Empty List");
   }
 
   std::size_t index = 0u;
-  Node* current = head_->next();
+  const Link* current = head_.next();
 
   while (index < size()) {
-    if (current->data() == data) {
+    if (as_node(current)->data() == data) {
       break;
     }
     current = current->next();
@@ -164,36 +182,74 @@ std::size_t structures::CircularList<T>::find(const T& data) const {
   return index;
 }
 
-template <typename T>
-T& structures::CircularList<T>::at(std::size_t index) {
+template <typename T, typename Allocator>
+T& structures::CircularList<T, Allocator>::at(std::size_t index) {
   return const_cast<T&>(static_cast<const CircularList*>(this)->at(index));
 }
 
-template <typename T>
-const T& structures::CircularList<T>::at(std::size_t index) const {
+template <typename T, typename Allocator>
+const T& structures::CircularList<T, Allocator>::at(std::size_t index) const {
   if (empty()) {
     throw std::out_of_range("List is empty");
   } else if (index >= size_) {
     throw std::out_of_range("Index out of bounds");
   }
 
-  Node* current = head_->next();
+  const Link* current = head_.next();
   auto i = 0;
   while (i != index) {
     current = current->next();
     i++;
   }
-  return current->data();
+  return as_node(current)->data();
 }
 
-template <typename T>
-T& structures::CircularList<T>::operator[](std::size_t index) {
+template <typename T, typename Allocator>
+T& structures::CircularList<T, Allocator>::operator[](std::size_t index) {
   return const_cast<T&>(static_cast<const CircularList*>(this)->at(index));
 }
 
-template <typename T>
-const T& structures::CircularList<T>::operator[](std::size_t index) const {
+template <typename T, typename Allocator>
+const T& structures::CircularList<T, Allocator>::operator[](
+    std::size_t index) const {
   return at(index);
 }
 
+template <typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::insert_node(
+    Node* new_node, std::size_t index) {
+  Link* before;
+  if (index == size_) {
+    before = tail_;
+    tail_ = new_node;
+  } else {
+    before = index == 0 ? &head_ : before_index(index);
+  }
+  new_node->next(before->next());
+  before->next(new_node);
+  size_++;
+}
+
+template <typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::take_nodes(CircularList& other) {
+  if (other.empty()) {
+    return;
+  }
+  head_.next(other.head_.next());
+  other.tail_->next(&head_);
+  tail_ = other.tail_;
+  size_ = other.size_;
+  other.head_.next(&other.head_);
+  other.tail_ = &other.head_;
+  other.size_ = 0u;
+}
+
+template <typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::destroy_node(Node* node) {
+  NodeTraits::destroy(allocator_, node);
+  NodeTraits::deallocate(allocator_, node, 1);
+}
+
 template class structures::CircularList<int>;
+template class structures::CircularList<int, std::allocator<int>>;
+template class structures::CircularList<std::string>;
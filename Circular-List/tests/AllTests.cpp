@@ -1,3 +1,8 @@
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
 #include "gtest/gtest.h"
 #include "circular_list.h"
 
@@ -239,3 +244,133 @@ TEST_F(CircularListTest, RemovePopsData) {
   list.remove(9);
   ASSERT_FALSE(list.contains(9));
 }
+
+TEST_F(CircularListTest, MoveConstructorTakesNodes) {
+  for (auto i = 0; i < 10; i++) {
+    list.push_back(i);
+  }
+  structures::CircularList<int> moved{std::move(list)};
+  ASSERT_EQ(10u, moved.size());
+  ASSERT_EQ(0, moved.at(0));
+  ASSERT_EQ(9, moved.at(9));
+  ASSERT_TRUE(list.empty());
+  list.push_back(1);
+  ASSERT_EQ(1, list.at(0));
+}
+
+TEST_F(CircularListTest, MoveAssignmentReplacesNodes) {
+  structures::CircularList<int> other{};
+  other.push_back(1);
+  other.push_back(2);
+  list.push_back(-1);
+  list = std::move(other);
+  ASSERT_EQ(2u, list.size());
+  ASSERT_EQ(1, list.at(0));
+  ASSERT_EQ(2, list.at(1));
+  ASSERT_TRUE(other.empty());
+}
+
+TEST_F(CircularListTest, PushRvalueMovesStrings) {
+  structures::CircularList<std::string> strings{};
+  std::string back(64, 'b');
+  std::string front(64, 'f');
+  strings.push_back(std::move(back));
+  strings.push_front(std::move(front));
+  strings.insert(std::string(64, 'i'), 1);
+  ASSERT_TRUE(back.empty());
+  ASSERT_TRUE(front.empty());
+  ASSERT_EQ(std::string(64, 'f'), strings.at(0));
+  ASSERT_EQ(std::string(64, 'i'), strings.at(1));
+  ASSERT_EQ(std::string(64, 'b'), strings.at(2));
+}
+
+TEST_F(CircularListTest, EmplaceConstructsInNodes) {
+  structures::CircularList<std::string> strings{};
+  ASSERT_EQ("bbb", strings.emplace_back(3u, 'b'));
+  ASSERT_EQ("a", strings.emplace_front("a"));
+  strings.emplace(1, 2u, 'x') += "y";
+  ASSERT_EQ(3u, strings.size());
+  ASSERT_EQ("a", strings.at(0));
+  ASSERT_EQ("xxy", strings.at(1));
+  ASSERT_EQ("bbb", strings.at(2));
+  ASSERT_THROW(strings.emplace(4, "z"), std::out_of_range);
+  ASSERT_EQ(3u, strings.size());
+}
+
+TEST_F(CircularListTest, PopMovesDataOut) {
+  structures::CircularList<std::string> strings{};
+  strings.push_back(std::string(64, 'a'));
+  strings.push_back(std::string(64, 'b'));
+  strings.push_back(std::string(64, 'c'));
+  ASSERT_EQ(std::string(64, 'b'), strings.pop(1));
+  ASSERT_EQ(std::string(64, 'c'), strings.pop_back());
+  ASSERT_EQ(std::string(64, 'a'), strings.pop_front());
+  ASSERT_TRUE(strings.empty());
+}
+
+TEST_F(CircularListTest, PoolReusesRemovedNodes) {
+  list.push_back(1);
+  const int* first = &list.at(0);
+  list.pop_front();
+  list.push_back(2);
+  ASSERT_EQ(first, &list.at(0));
+}
+
+TEST_F(CircularListTest, MovedListKeepsNodesOfItsPool) {
+  for (auto i = 0; i < 100; i++) {
+    list.push_back(i);
+  }
+  structures::CircularList<int> other{};
+  other.push_back(-1);
+  other = std::move(list);
+  structures::CircularList<int> moved{std::move(other)};
+  list.push_back(0);
+  other.push_back(0);
+  ASSERT_EQ(100u, moved.size());
+  ASSERT_EQ(99, moved.pop_back());
+  ASSERT_EQ(0, moved.pop_front());
+}
+
+TEST_F(CircularListTest, WorksWithStandardAllocator) {
+  structures::CircularList<int, std::allocator<int>> standard{};
+  standard.push_back(1);
+  standard.push_front(0);
+  standard.insert(2, 2);
+  structures::CircularList<int, std::allocator<int>> moved{
+      std::move(standard)};
+  ASSERT_TRUE(standard.empty());
+  ASSERT_EQ(3u, moved.size());
+  for (auto i = 0; i < 3; i++) {
+    ASSERT_EQ(i, moved.pop_front());
+  }
+}
+
+TEST_F(CircularListTest, EmptyListDoesNotAllocate) {
+  ASSERT_TRUE(std::is_nothrow_default_constructible<
+              structures::CircularList<std::string>>::value);
+  structures::CircularList<std::string> strings{};
+  structures::CircularList<std::string> moved{std::move(strings)};
+  ASSERT_TRUE(moved.empty());
+  ASSERT_THROW(moved.pop_front(), std::out_of_range);
+}
+
+TEST_F(CircularListTest, MovedListsKeepTheirOwnSentinels) {
+  for (auto i = 0; i < 3; i++) {
+    list.push_back(i);
+  }
+  structures::CircularList<int> moved{std::move(list)};
+  moved.push_back(3);
+  list.push_back(-1);
+  ASSERT_EQ(1u, list.size());
+  ASSERT_EQ(-1, list.at(0));
+  list = std::move(moved);
+  list.pop(3);
+  list.push_back(4);
+  ASSERT_EQ(4u, list.size());
+  for (auto i = 0; i < 3; i++) {
+    ASSERT_EQ(i, list.pop_front());
+  }
+  ASSERT_EQ(4, list.pop_back());
+  list.push_back(5);
+  ASSERT_EQ(5, list.at(0));
+}
@@ -0,0 +1,60 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+#include "doubly_circular_list.h"
+
+// Criação e destruição de OPERATIONS listas DoublyCircularList<int> vazias,
+// com o PoolAllocator padrão e com std::allocator. Conta as chamadas ao
+// alocador global com a substituição do operator new.
+
+namespace {
+std::size_t allocations = 0;
+
+const std::size_t OPERATIONS = 10000000;
+}  // namespace
+
+void* operator new(std::size_t size) {
+  allocations++;
+  void* pointer = std::malloc(size == 0 ? 1 : size);
+  if (pointer == nullptr) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+
+void operator delete(void* pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+
+namespace {
+template <typename List>
+std::size_t create(const char* name) {
+  std::size_t before = allocations;
+  auto start = std::chrono::steady_clock::now();
+  std::size_t sizes = 0;
+  for (std::size_t i = 0; i != OPERATIONS; i++) {
+    List list;
+    asm volatile("" : : "r"(&list) : "memory");
+    sizes += list.size();
+  }
+  auto end = std::chrono::steady_clock::now();
+  std::chrono::duration<double> elapsed = end - start;
+  std::printf("%-16s %14.0f %12zu\n", name, OPERATIONS / elapsed.count(),
+              allocations - before);
+  return sizes;
+}
+}  // namespace
+
+int main(void) {
+  std::printf("%-16s %14s %12s\n", "allocator", "lists/s", "allocations");
+  std::size_t sizes =
+      create<structures::DoublyCircularList<int>>("PoolAllocator");
+  sizes += create<structures::DoublyCircularList<int, std::allocator<int>>>(
+      "std::allocator");
+  return sizes != 0;
+}
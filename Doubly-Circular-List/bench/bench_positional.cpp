@@ -0,0 +1,53 @@
+#include <chrono>
+#include <cstdio>
+
+#include "doubly_circular_list.h"
+
+// Operações por posição em uma DoublyCircularList<int> de SIZE elementos:
+// acesso (at) e inserção seguida de remoção (insert e pop) nos últimos
+// NEAR_END elementos, e o passo de um escalonador round-robin, que leva o
+// primeiro elemento para o fim, com pop_front e push_back ou com rotate.
+// Reporta o tempo médio por operação.
+
+namespace {
+const std::size_t SIZE = 20000;
+const std::size_t NEAR_END = 16;
+const std::size_t ROUNDS = 1000000;
+
+template <typename F>
+void run(const char* name, std::size_t operations, F operation) {
+  auto start = std::chrono::steady_clock::now();
+  long sum = 0;
+  for (std::size_t i = 0; i != operations; i++) {
+    sum += operation(i);
+  }
+  auto end = std::chrono::steady_clock::now();
+  std::chrono::duration<double, std::nano> elapsed = end - start;
+  std::printf("%-16s %12.1f %12ld\n", name, elapsed.count() / operations, sum);
+}
+}  // namespace
+
+int main(void) {
+  structures::DoublyCircularList<int> list;
+  for (std::size_t i = 0; i != SIZE; i++) {
+    list.push_back(static_cast<int>(i));
+  }
+
+  std::printf("%-16s %12s %12s\n", "operation", "ns/op", "checksum");
+  run("at near-end", SIZE,
+      [&](std::size_t i) { return list.at(SIZE - 1 - i % NEAR_END); });
+  run("insert+pop", SIZE, [&](std::size_t i) {
+    std::size_t index = SIZE - i % NEAR_END;
+    list.insert(static_cast<int>(i), index);
+    return list.pop(index);
+  });
+  run("requeue", ROUNDS, [&](std::size_t) {
+    list.push_back(list.pop_front());
+    return list.at(0);
+  });
+  run("rotate", ROUNDS, [&](std::size_t) {
+    list.rotate();
+    return list.at(0);
+  });
+  return 0;
+}
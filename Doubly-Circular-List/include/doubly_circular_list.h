@@ -2,10 +2,15 @@
 #define STRUCTURES_CIRCULAR_LIST_H
 
 #include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "pool_allocator.h"
 
 namespace structures {
 
-template <typename T>
+template <typename T, typename Allocator = PoolAllocator<T>>
 //! Classe DoubleCircularList
 /*!
    Classe lista circular duplamente encadeada.
@@ -14,9 +19,18 @@ class DoublyCircularList {
  public:
   //! Construtor
   /*!
-     Construtor padrão. Inicializa o nodo sentinela e o tamanho da lista.
+     Construtor padrão. Inicializa o sentinela embutido e o tamanho da lista,
+     sem alocar memória.
+   */
+  DoublyCircularList(void) noexcept;
+
+  //! Construtor de movimento
+  /*!
+     Cria uma lista tomando para si os nodos de other, sem copiar os dados.
+     other fica vazia.
+     \param other: Lista de origem (DoublyCircularList&&).
    */
-  DoublyCircularList(void);
+  DoublyCircularList(DoublyCircularList&& other);
 
   //! Destrutor
   /*!
@@ -24,6 +38,15 @@ class DoublyCircularList {
    */
   ~DoublyCircularList(void);
 
+  //! Atribuição por movimento
+  /*!
+     Remove os elementos atuais e toma para si os nodos de other, sem copiar os
+     dados. other fica vazia.
+     \param other: Lista de origem (DoublyCircularList&&).
+     \return Referência para esta lista (DoublyCircularList&).
+   */
+  DoublyCircularList& operator=(DoublyCircularList&& other);
+
   //! Método limpa
   /*!
      Limpa a lista.
@@ -39,6 +62,26 @@ class DoublyCircularList {
    */
   void push_back(const T& data);
 
+  //! Método adiciona no fim da lista (movimento)
+  /*!
+     Como push_back(const T&), mas move data para o novo nodo em vez de
+     copiá-lo.
+     \param data: Elemento a ser movido para a lista (T&&).
+   */
+  void push_back(T&& data);
+
+  //! Método constrói no fim da lista
+  /*!
+     Constrói o elemento diretamente em um novo nodo no fim da lista,
+     repassando args ao construtor de T, sem cópias nem movimentos.
+     \param args: Argumentos repassados ao construtor de T.
+     \return Referência ao elemento adicionado (T&).
+   */
+  template <typename... Args>
+  T& emplace_back(Args&&... args) {
+    return emplace(size_, std::forward<Args>(args)...);
+  }
+
   //! Método adiciona no início da lista
   /*!
      Adiciona elemento (data) no início da lista, se houver espaço. Se não
@@ -48,6 +91,25 @@ class DoublyCircularList {
    */
   void push_front(const T& data);
 
+  //! Método adiciona no início da lista (movimento)
+  /*!
+     Como push_front(const T&), mas move data para o novo nodo em vez de
+     copiá-lo.
+     \param data: Elemento a ser movido para a lista (T&&).
+   */
+  void push_front(T&& data);
+
+  //! Método constrói no início da lista
+  /*!
+     Como emplace_back, mas adiciona o elemento no início da lista.
+     \param args: Argumentos repassados ao construtor de T.
+     \return Referência ao elemento adicionado (T&).
+   */
+  template <typename... Args>
+  T& emplace_front(Args&&... args) {
+    return emplace(0u, std::forward<Args>(args)...);
+  }
+
   //! Método insere na posição
   /*!
      Insere elemento (data) em uma dada posição da lista (index), se houver
@@ -58,6 +120,33 @@ class DoublyCircularList {
    */
   void insert(const T& data, std::size_t index);
 
+  //! Método insere na posição (movimento)
+  /*!
+     Como insert(const T&, size_t), mas move data para o novo nodo em vez de
+     copiá-lo.
+     \param data: Elemento a ser movido para a lista (T&&).
+     \param index: Posição para inserir o elemento (size_t).
+   */
+  void insert(T&& data, std::size_t index);
+
+  //! Método constrói na posição
+  /*!
+     Como emplace_back, mas insere o elemento na posição index. Se a posição
+     não for válida, lança exceção (out_of_range) sem construir o elemento.
+     \param index: Posição para inserir o elemento (size_t).
+     \param args: Argumentos repassados ao construtor de T.
+     \return Referência ao elemento inserido (T&).
+   */
+  template <typename... Args>
+  T& emplace(std::size_t index, Args&&... args) {
+    if (index > size_) {
+      throw std::out_of_range("Invalid index");
+    }
+    Node* new_node = make_node(std::forward<Args>(args)...);
+    insert_node(new_node, index);
+    return new_node->data();
+  }
+
   //! Método insere ordenado
   /*!
      Insere elemento (data) em ordem na lista (caso a lista possua ordem). Se
@@ -109,7 +198,7 @@ class DoublyCircularList {
      posição for válida. Se não há elementos ou a posição não é válida, lança
      exceção (out_of_range).
      \param index: Posição do elemento a ser removido (size_t).
-     \return Elemento removido (T)
+     \return Elemento removido, movido para fora do nodo (T).
    */
   T pop(std::size_t index);
 
@@ -117,7 +206,7 @@ class DoublyCircularList {
   /*!
      Remove elemento no final da lista, se houver elementos. Se não houver
      elementos, lança exceção (out_of_range).
-     \return Elemento removido (T).
+     \return Elemento removido, movido para fora do nodo (T).
    */
   T pop_back(void);
 
@@ -126,7 +215,7 @@ class DoublyCircularList {
      Remove elemento no início da lista e move os elementos restantes "um passo
      para frente", se houver elementos. Se não houver elementos, lança exceção
      (out_of_range).
-     \return Elemento removido (T)
+     \return Elemento removido, movido para fora do nodo (T).
    */
   T pop_front(void);
 
@@ -140,6 +229,50 @@ class DoublyCircularList {
    */
   void remove(const T& data);
 
+  //! Método rotaciona
+  /*!
+     Move os count primeiros elementos para o fim da lista, mantendo a ordem,
+     sem mover dados nem alocar nodos: apenas o sentinela troca de lugar. Com
+     count igual a 1, custo constante; em geral, percorre min(count, size -
+     count) nodos. count maior que o tamanho é tomado módulo o tamanho.
+     \param count: Quantidade de elementos movidos para o fim (size_t).
+   */
+  void rotate(std::size_t count = 1u);
+
+  //! Método transfere lista
+  /*!
+     Move todos os elementos de other para esta lista, a partir da posição
+     index, mantendo a ordem. other fica vazia. Os nodos são reencadeados sem
+     copiar dados quando os alocadores podem liberar os nodos um do outro: se
+     são iguais, ou se este PoolAllocator absorve os blocos de other; nos
+     demais casos, os elementos são movidos um a um. Lança exceção
+     (invalid_argument) se other for esta lista e (out_of_range) se index for
+     inválido.
+     \param index: Posição do primeiro elemento transferido (size_t).
+     \param other: Lista de origem (DoublyCircularList&).
+   */
+  void splice(std::size_t index, DoublyCircularList& other);
+
+  //! Método transfere intervalo
+  /*!
+     Move os elementos de other nas posições [first, last) para esta lista, a
+     partir da posição index, mantendo a ordem. Como no splice da lista
+     inteira, os nodos são reencadeados em tempo constante, além de localizar
+     as três posições pelo lado mais próximo, quando os alocadores são iguais
+     ou quando este PoolAllocator passa a compartilhar os blocos de other.
+     Nos demais casos, os elementos são movidos para nodos novos, todos
+     criados antes de os originais serem retirados: se a criação lançar
+     exceção, as duas listas ficam como estavam. Lança exceção
+     (invalid_argument) se other for esta lista e (out_of_range) se index ou
+     o intervalo forem inválidos.
+     \param index: Posição do primeiro elemento transferido (size_t).
+     \param other: Lista de origem (DoublyCircularList&).
+     \param first: Posição do primeiro elemento do intervalo (size_t).
+     \param last: Posição seguinte ao último elemento do intervalo (size_t).
+   */
+  void splice(std::size_t index, DoublyCircularList& other, std::size_t first,
+              std::size_t last);
+
   //! Método vazio
   /*!
      Verifica se a lista está vazia. Retorna verdadeiro se estiver vazia, caso
@@ -176,55 +309,161 @@ class DoublyCircularList {
   std::size_t size(void) const;
 
  private:
-  class Node {
+  //! Classe Link
+  /*!
+     Encadeamento de um nodo, sem o dado. O sentinela da lista é um Link
+     embutido nela, que aponta para si mesmo enquanto a lista está vazia.
+   */
+  class Link {
    public:
-    explicit Node(const T& data)
-        : data_{data}, previous_{nullptr}, next_{nullptr} {}
+    Link(void) : previous_{this}, next_{this} {}
 
-    Node(const T& data, Node* next)
-        : data_{data}, previous_{nullptr}, next_{next} {}
+    Link* previous(void) { return previous_; }
 
-    Node(const T& data, Node* previous, Node* next)
-        : data_{data}, previous_{previous}, next_{next} {}
+    const Link* previous(void) const { return previous_; }
 
-    T& data(void) { return data_; };
+    void previous(Link* link) { previous_ = link; }
 
-    const T& data(void) const { return data_; }
+    Link* next(void) { return next_; }
 
-    Node* previous(void) { return previous_; }
+    const Link* next(void) const { return next_; }
 
-    const Node* previous(void) const { return previous_; }
+    void next(Link* link) { next_ = link; }
 
-    void previous(Node* node) { previous_ = node; }
+   private:
+    Link* previous_;
+    Link* next_;
+  };
 
-    Node* next(void) { return next_; }
+  class Node : public Link {
+   public:
+    template <typename... Args>
+    explicit Node(std::in_place_t, Args&&... args)
+        : data_(std::forward<Args>(args)...) {}
 
-    const Node* next(void) const { return next_; }
+    T& data(void) { return data_; };
 
-    void next(Node* node) { next_ = node; }
+    const T& data(void) const { return data_; }
 
    private:
     T data_;
-    Node* previous_;
-    Node* next_;
   };
 
-  Node* node(std::size_t index) {
-    Node* node = head_->next();
+  //! Método nodo do encadeamento
+  /*!
+     Converte um encadeamento que não é o sentinela no nodo que o contém.
+     \param link: Encadeamento de um nodo (Link *).
+     \return Nodo (Node *).
+   */
+  static Node* as_node(Link* link) { return static_cast<Node*>(link); }
 
-    for (std::size_t i = 0; i < size(); i++) {
-      if (i == index) {
-        return node;
-      }
-      node = node->next();
+  static const Node* as_node(const Link* link) {
+    return static_cast<const Node*>(link);
+  }
+
+  //! Alocador de nodos
+  using NodeAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+
+  //! Operações do alocador de nodos
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+  //! Método cria nodo
+  /*!
+     Obtém um nodo do alocador e constrói nele o dado, repassando args ao
+     construtor de T. Se a construção lançar exceção, devolve o nodo ao
+     alocador.
+     \param args: Argumentos repassados ao construtor de T.
+     \return Nodo criado, ainda não encadeado (Node *).
+   */
+  template <typename... Args>
+  Node* make_node(Args&&... args) {
+    Node* node = NodeTraits::allocate(allocator_, 1);
+    try {
+      NodeTraits::construct(allocator_, node, std::in_place,
+                            std::forward<Args>(args)...);
+    } catch (...) {
+      NodeTraits::deallocate(allocator_, node, 1);
+      throw;
     }
+    return node;
+  }
+
+  //! Método destrói nodo
+  /*!
+     Destrói o dado do nodo e devolve o nodo ao alocador.
+     \param node: Nodo já desencadeado (Node *).
+   */
+  void destroy_node(Node* node);
 
+  //! Método insere nodo
+  /*!
+     Encadeia um nodo já construído na posição index, que deve ser válida.
+     \param new_node: Nodo a ser inserido (Node *).
+     \param index: Posição do nodo na lista (size_t).
+   */
+  void insert_node(Node* new_node, std::size_t index);
+
+  //! Método encadeia intervalo
+  /*!
+     Encadeia os nodos de first a last, já ligados entre si, logo após before.
+     \param before: Nodo, ou sentinela, que antecede o intervalo (Link *).
+     \param first: Primeiro nodo do intervalo (Link *).
+     \param last: Último nodo do intervalo (Link *).
+   */
+  static void link(Link* before, Link* first, Link* last);
+
+  //! Método desencadeia intervalo
+  /*!
+     Retira os nodos de first a last da lista, ligando os seus vizinhos. Os
+     nodos continuam ligados entre si.
+     \param first: Primeiro nodo do intervalo (Link *).
+     \param last: Último nodo do intervalo (Link *).
+   */
+  static void unlink(Link* first, Link* last);
+
+  //! Método toma nodos
+  /*!
+     Encadeia os nodos de other no sentinela desta lista, que deve estar
+     vazia, e deixa other vazia.
+     \param other: Lista de origem (DoublyCircularList&).
+   */
+  void take_nodes(DoublyCircularList& other);
+
+  //! Método nodo na posição
+  /*!
+     Percorre a lista a partir do sentinela pelo lado mais próximo de index:
+     para frente na primeira metade, para trás na segunda. Com index igual ao
+     tamanho, retorna o próprio sentinela.
+     \param index: Posição do nodo, em [0, size] (size_t).
+     \return Nodo na posição (Link *).
+   */
+  Link* node(std::size_t index) {
+    return const_cast<Link*>(
+        static_cast<const DoublyCircularList*>(this)->node(index));
+  }
+
+  const Link* node(std::size_t index) const {
+    const Link* node = &head_;
+    if (index < size_ / 2) {
+      for (std::size_t i = 0; i <= index; i++) {
+        node = node->next();
+      }
+    } else {
+      for (std::size_t i = size_; i != index; i--) {
+        node = node->previous();
+      }
+    }
     return node;
   }
 
-  Node* head_;
+  //! Sentinela, sem dado, embutido na lista: uma lista vazia não aloca nada
+  Link head_;
 
   std::size_t size_;
+
+  //! Alocador dos nodos da lista
+  NodeAllocator allocator_;
 };
 
 }  // namespace structures
@@ -1,93 +1,115 @@
 #include "doubly_circular_list.h"
 
+#include <memory>
 #include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace {
+//! Função adota nodos
+/*!
+   Prepara to para liberar os nodos alocados por from. Alocadores iguais
+   compartilham nodos; nos demais casos, retorna falso.
+ */
+template <typename A>
+bool adopt(A& to, A& from) {
+  return to == from;
+}
+
+//! Função adota nodos
+/*!
+   Um PoolAllocator absorve os blocos de from e passa a liberar seus nodos.
+ */
+template <typename N>
+bool adopt(structures::PoolAllocator<N>& to,
+           structures::PoolAllocator<N>& from) {
+  to.merge(from);
+  return true;
+}
+}  // namespace
 
-template <typename T>
-structures::DoublyCircularList<T>::DoublyCircularList(void) {
+template <typename T, typename Allocator>
+structures::DoublyCircularList<T, Allocator>::DoublyCircularList(
+    void) noexcept {
   size_ = 0u;
-  head_ = new Node((T)0);
-  head_->next(head_);
-  head_->previous(head_);
 }
 
-template <typename T>
-structures::DoublyCircularList<T>::~DoublyCircularList(void) {
-  clear();
+template <typename T, typename Allocator>
+structures::DoublyCircularList<T, Allocator>::DoublyCircularList(
+    DoublyCircularList&& other)
+    : allocator_{std::move(other.allocator_)} {
+  size_ = 0u;
+  take_nodes(other);
 }
 
-template <typename T>
-void structures::DoublyCircularList<T>::clear(void) {
-  while (!empty()) {
-    pop_front();
-  }
+template <typename T, typename Allocator>
+structures::DoublyCircularList<T, Allocator>::~DoublyCircularList(void) {
+  clear();
 }
 
-template <typename T>
-void structures::DoublyCircularList<T>::push_back(const T& data) {
-  if (empty()) {
-    push_front(data);
-  } else {
-    Node* new_node = new Node(data, head_->previous(), head_);
-    if (new_node == nullptr) {
-      throw std::out_of_range("Cannot push to full list");
-    }
-    head_->previous()->next(new_node);
-    head_->previous(new_node);
-    size_++;
+template <typename T, typename Allocator>
+structures::DoublyCircularList<T, Allocator>&
+structures::DoublyCircularList<T, Allocator>::operator=(
+    DoublyCircularList&& other) {
+  if (this != &other) {
+    clear();
+    allocator_ = std::move(other.allocator_);
+    take_nodes(other);
   }
+  return *this;
 }
 
-template <typename T>
-void structures::DoublyCircularList<T>::push_front(const T& data) {
-  Node* new_node = new Node(data, head_, head_->next());
-
-  if (new_node == nullptr) {
-    delete new_node;
-    throw std::out_of_range("Cannot push front on full list");
+template <typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::clear(void) {
+  while (!empty()) {
+    pop_front();
   }
+}
 
-  head_->next()->previous(new_node);
-  head_->next(new_node);
-
-  size_++;
+template <typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::push_back(const T& data) {
+  emplace_back(data);
 }
 
-template <typename T>
-void structures::DoublyCircularList<T>::insert(const T& data,
-                                               std::size_t index) {
-  if (index > size_) {
-    throw std::out_of_range("Invalid index");
-  }
+template <typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::push_back(T&& data) {
+  emplace_back(std::move(data));
+}
 
-  if (index == 0) {
-    push_front(data);
-  } else if (index == size_) {
-    push_back(data);
-  } else {
-    Node* before = node(index - 1);
-    Node* new_node = new Node(data, before, before->next());
+template <typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::push_front(const T& data) {
+  emplace_front(data);
+}
 
-    if (new_node == nullptr) {
-      throw std::out_of_range("Cannot insert on full list");
-    }
+template <typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::push_front(T&& data) {
+  emplace_front(std::move(data));
+}
 
-    before->next()->previous(new_node);
-    before->next(new_node);
+template <typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::insert(const T& data,
+                                                          std::size_t index) {
+  emplace(index, data);
+}
 
-    size_++;
-  }
+template <typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::insert(T&& data,
+                                                          std::size_t index) {
+  emplace(index, std::move(data));
 }
 
-template <typename T>
-void structures::DoublyCircularList<T>::insert_sorted(const T& data) {
+template <typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::insert_sorted(
+    const T& data) {
   if (empty()) {
     push_front(data);
   } else {
-    Node* current = head_->next();
+    Link* current = head_.next();
     std::size_t position = size_;
 
     for (auto index = 0; index < size_; index++) {
-      if (!(data > current->data())) {
+      if (!(data > as_node(current)->data())) {
         position = index;
         break;
       }
@@ -98,8 +120,8 @@ void structures::DoublyCircularList<T>::insert_sorted(const T& data) {
   }
 }
 
-template <typename T>
-T structures::DoublyCircularList<T>::pop_back(void) {
+template <typename T, typename Allocator>
+T structures::DoublyCircularList<T, Allocator>::pop_back(void) {
   if (empty()) {
     throw std::out_of_range("Cannot pop from empty list");
   }
@@ -108,35 +130,33 @@ T structures::DoublyCircularList<T>::pop_back(void) {
     return pop_front();
   }
 
-  Node* out = node(size_ - 1);
-  T data = out->data();
+  Node* out = as_node(head_.previous());
+  T data = std::move(out->data());
 
-  out->previous()->next(out->next());
-  out->next()->previous(out->previous());
+  unlink(out, out);
   size_--;
-  delete out;
+  destroy_node(out);
 
   return data;
 }
 
-template <typename T>
-T structures::DoublyCircularList<T>::pop_front(void) {
+template <typename T, typename Allocator>
+T structures::DoublyCircularList<T, Allocator>::pop_front(void) {
   if (empty()) {
     throw std::out_of_range("Cannot pop from empty list");
   }
 
-  Node* out = head_->next();
-  T data = out->data();
-  out->next()->previous(head_);
-  head_->next(out->next());
-  delete out;
+  Node* out = as_node(head_.next());
+  T data = std::move(out->data());
+  unlink(out, out);
+  destroy_node(out);
   size_--;
 
   return data;
 }
 
-template <typename T>
-T structures::DoublyCircularList<T>::pop(std::size_t index) {
+template <typename T, typename Allocator>
+T structures::DoublyCircularList<T, Allocator>::pop(std::size_t index) {
   if (empty()) {
     throw std::out_of_range("Empty List");
   }
@@ -153,78 +173,174 @@ T structures::DoublyCircularList<T>::pop(std::size_t index) {
     return pop_back();
   }
 
-  Node* out = node(index);
-  T data = out->data();
-  out->previous()->next(out->next());
-  out->next()->previous(out->previous());
-  delete out;
+  Node* out = as_node(node(index));
+  T data = std::move(out->data());
+  unlink(out, out);
+  destroy_node(out);
   size_--;
 
   return data;
 }
 
-template <typename T>
-void structures::DoublyCircularList<T>::remove(const T& data) {
+template <typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::remove(const T& data) {
   pop(find(data));
 }
 
-template <typename T>
-bool structures::DoublyCircularList<T>::empty(void) const {
+template <typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::rotate(std::size_t count) {
+  if (size_ < 2) {
+    return;
+  }
+  count %= size_;
+  if (count == 0) {
+    return;
+  }
+  Link* last = node(count - 1);
+  unlink(&head_, &head_);
+  link(last, &head_, &head_);
+}
+
+template <typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::splice(
+    std::size_t index, DoublyCircularList& other) {
+  if (this == &other) {
+    throw std::invalid_argument("Cannot splice a list into itself");
+  }
+  if (index > size_) {
+    throw std::out_of_range("Invalid index");
+  }
+  if (other.empty()) {
+    return;
+  }
+  if (!adopt(allocator_, other.allocator_)) {
+    splice(index, other, 0u, other.size_);
+    return;
+  }
+  Link* first = other.head_.next();
+  Link* last = other.head_.previous();
+  unlink(first, last);
+  link(node(index)->previous(), first, last);
+  size_ += other.size_;
+  other.size_ = 0u;
+}
+
+template <typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::splice(
+    std::size_t index, DoublyCircularList& other, std::size_t first,
+    std::size_t last) {
+  if (this == &other) {
+    throw std::invalid_argument("Cannot splice a list into itself");
+  }
+  if (index > size_ || first > last || last > other.size_) {
+    throw std::out_of_range("Invalid range");
+  }
+  if (first == last) {
+    return;
+  }
+  Link* before = node(index)->previous();
+  Link* first_node = other.node(first);
+  Link* last_node = other.node(last - 1);
+  if (!adopt(allocator_, other.allocator_)) {
+    // Cria os novos nodos antes de retirar os originais de other: se a
+    // criação lançar exceção, os dados movidos voltam para os originais e as
+    // duas listas ficam como estavam.
+    std::size_t count = last - first;
+    std::size_t made = 0u;
+    Link* copies = nullptr;
+    Link* copy = nullptr;
+    try {
+      for (Link* source = first_node; made != count; made++) {
+        Node* new_node =
+            make_node(std::move_if_noexcept(as_node(source)->data()));
+        if (copy == nullptr) {
+          copies = new_node;
+        } else {
+          new_node->previous(copy);
+          copy->next(new_node);
+        }
+        copy = new_node;
+        source = source->next();
+      }
+    } catch (...) {
+      for (Link* source = first_node; made != 0u; made--) {
+        Link* next = copies->next();
+        if (std::is_nothrow_move_constructible<T>::value) {
+          as_node(source)->data() = std::move(as_node(copies)->data());
+        }
+        destroy_node(as_node(copies));
+        copies = next;
+        source = source->next();
+      }
+      throw;
+    }
+    unlink(first_node, last_node);
+    link(before, copies, copy);
+    for (Link* source = first_node; count != 0u; count--) {
+      Link* next = source->next();
+      other.destroy_node(as_node(source));
+      source = next;
+    }
+  } else {
+    unlink(first_node, last_node);
+    link(before, first_node, last_node);
+  }
+  size_ += last - first;
+  other.size_ -= last - first;
+}
+
+template <typename T, typename Allocator>
+bool structures::DoublyCircularList<T, Allocator>::empty(void) const {
   return size_ == 0u;
 }
 
-template <typename T>
-bool structures::DoublyCircularList<T>::contains(const T& data) const {
+template <typename T, typename Allocator>
+bool structures::DoublyCircularList<T, Allocator>::contains(
+    const T& data) const {
   return find(data) != size();
 }
 
-template <typename T>
-T& structures::DoublyCircularList<T>::at(std::size_t index) {
+template <typename T, typename Allocator>
+T& structures::DoublyCircularList<T, Allocator>::at(std::size_t index) {
   return const_cast<T&>(
       static_cast<const DoublyCircularList*>(this)->at(index));
 }
 
-template <typename T>
-const T& structures::DoublyCircularList<T>::at(std::size_t index) const {
+template <typename T, typename Allocator>
+const T& structures::DoublyCircularList<T, Allocator>::at(
+    std::size_t index) const {
   if (empty()) {
     throw std::out_of_range("List is empty");
   } else if (index >= size_) {
     throw std::out_of_range("Index out of bounds");
   }
-  Node* current = head_->next();
-  auto i = 0;
-
-  while (i != index) {
-    current = current->next();
-    i++;
-  }
-
-  return current->data();
+  return as_node(node(index))->data();
 }
 
-template <typename T>
-T& structures::DoublyCircularList<T>::operator[](std::size_t index) {
+template <typename T, typename Allocator>
+T& structures::DoublyCircularList<T, Allocator>::operator[](std::size_t index) {
   return at(index);
 }
 
-template <typename T>
-const T& structures::DoublyCircularList<T>::operator[](
+template <typename T, typename Allocator>
+const T& structures::DoublyCircularList<T, Allocator>::operator[](
     std::size_t index) const {
   return const_cast<T&>(
       static_cast<const DoublyCircularList*>(this)->at(index));
 }
 
-template <typename T>
-std::size_t structures::DoublyCircularList<T>::find(const T& data) const {
+template <typename T, typename Allocator>
+std::size_t structures::DoublyCircularList<T, Allocator>::find(
+    const T& data) const {
   if (empty()) {
     throw std::out_of_range("List is empty");
   }
 
   std::size_t index = 0u;
-  Node* current = head_->next();
+  const Link* current = head_.next();
 
   while (index < size()) {
-    if (current->data() == data) {
+    if (as_node(current)->data() == data) {
       break;
     }
     current = current->next();
@@ -234,9 +350,56 @@ std::size_t structures::DoublyCircularList<T>::find(const T& data) const {
   return index;
 }
 
-template <typename T>
-std::size_t structures::DoublyCircularList<T>::size(void) const {
+template <typename T, typename Allocator>
+std::size_t structures::DoublyCircularList<T, Allocator>::size(void) const {
   return size_;
 }
 
+template <typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::insert_node(
+    Node* new_node, std::size_t index) {
+  link(node(index)->previous(), new_node, new_node);
+  size_++;
+}
+
+template <typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::link(Link* before,
+                                                        Link* first,
+                                                        Link* last) {
+  Link* after = before->next();
+  first->previous(before);
+  last->next(after);
+  before->next(first);
+  after->previous(last);
+}
+
+template <typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::unlink(Link* first,
+                                                          Link* last) {
+  first->previous()->next(last->next());
+  last->next()->previous(first->previous());
+}
+
+template <typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::take_nodes(
+    DoublyCircularList& other) {
+  if (other.empty()) {
+    return;
+  }
+  Link* first = other.head_.next();
+  Link* last = other.head_.previous();
+  unlink(first, last);
+  link(&head_, first, last);
+  size_ = other.size_;
+  other.size_ = 0u;
+}
+
+template <typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::destroy_node(Node* node) {
+  NodeTraits::destroy(allocator_, node);
+  NodeTraits::deallocate(allocator_, node, 1);
+}
+
 template class structures::DoublyCircularList<int>;
+template class structures::DoublyCircularList<int, std::allocator<int>>;
+template class structures::DoublyCircularList<std::string>;
@@ -1,3 +1,8 @@
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
 #include "doubly_circular_list.h"
 #include "gtest/gtest.h"
 
@@ -247,3 +252,239 @@ TEST_F(DoublyCircularListTest, PopIndexZeroPopsFront) {
  list.remove(9);
  ASSERT_FALSE(list.contains(9));
 }
+
+TEST_F(DoublyCircularListTest, MoveConstructorTakesNodes) {
+  for (auto i = 0; i < 10; i++) {
+    list.push_back(i);
+  }
+  structures::DoublyCircularList<int> moved{std::move(list)};
+  ASSERT_EQ(10u, moved.size());
+  ASSERT_EQ(0, moved.at(0));
+  ASSERT_EQ(9, moved.at(9));
+  ASSERT_TRUE(list.empty());
+  list.push_back(1);
+  ASSERT_EQ(1, list.at(0));
+}
+
+TEST_F(DoublyCircularListTest, MoveAssignmentReplacesNodes) {
+  structures::DoublyCircularList<int> other{};
+  other.push_back(1);
+  other.push_back(2);
+  list.push_back(-1);
+  list = std::move(other);
+  ASSERT_EQ(2u, list.size());
+  ASSERT_EQ(1, list.at(0));
+  ASSERT_EQ(2, list.at(1));
+  ASSERT_TRUE(other.empty());
+}
+
+TEST_F(DoublyCircularListTest, PushRvalueMovesStrings) {
+  structures::DoublyCircularList<std::string> strings{};
+  std::string back(64, 'b');
+  std::string front(64, 'f');
+  strings.push_back(std::move(back));
+  strings.push_front(std::move(front));
+  strings.insert(std::string(64, 'i'), 1);
+  ASSERT_TRUE(back.empty());
+  ASSERT_TRUE(front.empty());
+  ASSERT_EQ(std::string(64, 'f'), strings.at(0));
+  ASSERT_EQ(std::string(64, 'i'), strings.at(1));
+  ASSERT_EQ(std::string(64, 'b'), strings.at(2));
+}
+
+TEST_F(DoublyCircularListTest, EmplaceConstructsInNodes) {
+  structures::DoublyCircularList<std::string> strings{};
+  ASSERT_EQ("bbb", strings.emplace_back(3u, 'b'));
+  ASSERT_EQ("a", strings.emplace_front("a"));
+  strings.emplace(1, 2u, 'x') += "y";
+  ASSERT_EQ(3u, strings.size());
+  ASSERT_EQ("a", strings.at(0));
+  ASSERT_EQ("xxy", strings.at(1));
+  ASSERT_EQ("bbb", strings.at(2));
+  ASSERT_THROW(strings.emplace(4, "z"), std::out_of_range);
+  ASSERT_EQ(3u, strings.size());
+}
+
+TEST_F(DoublyCircularListTest, PopMovesDataOut) {
+  structures::DoublyCircularList<std::string> strings{};
+  strings.push_back(std::string(64, 'a'));
+  strings.push_back(std::string(64, 'b'));
+  strings.push_back(std::string(64, 'c'));
+  ASSERT_EQ(std::string(64, 'b'), strings.pop(1));
+  ASSERT_EQ(std::string(64, 'c'), strings.pop_back());
+  ASSERT_EQ(std::string(64, 'a'), strings.pop_front());
+  ASSERT_TRUE(strings.empty());
+}
+
+TEST_F(DoublyCircularListTest, PoolReusesRemovedNodes) {
+  list.push_back(1);
+  const int* first = &list.at(0);
+  list.pop_front();
+  list.push_back(2);
+  ASSERT_EQ(first, &list.at(0));
+}
+
+TEST_F(DoublyCircularListTest, MovedListKeepsNodesOfItsPool) {
+  for (auto i = 0; i < 100; i++) {
+    list.push_back(i);
+  }
+  structures::DoublyCircularList<int> other{};
+  other.push_back(-1);
+  other = std::move(list);
+  structures::DoublyCircularList<int> moved{std::move(other)};
+  list.push_back(0);
+  other.push_back(0);
+  ASSERT_EQ(100u, moved.size());
+  ASSERT_EQ(99, moved.pop_back());
+  ASSERT_EQ(0, moved.pop_front());
+}
+
+TEST_F(DoublyCircularListTest, WorksWithStandardAllocator) {
+  structures::DoublyCircularList<int, std::allocator<int>> standard{};
+  standard.push_back(1);
+  standard.push_front(0);
+  standard.insert(2, 2);
+  structures::DoublyCircularList<int, std::allocator<int>> moved{
+      std::move(standard)};
+  ASSERT_TRUE(standard.empty());
+  ASSERT_EQ(3u, moved.size());
+  for (auto i = 0; i < 3; i++) {
+    ASSERT_EQ(i, moved.pop_front());
+  }
+}
+
+TEST_F(DoublyCircularListTest, PositionalAccessFromBothEnds) {
+  for (auto i = 0; i < 10; i++) {
+    list.push_back(i);
+  }
+  list.insert(-1, 8);
+  ASSERT_EQ(-1, list.at(8));
+  ASSERT_EQ(8, list.at(9));
+  ASSERT_EQ(-1, list.pop(8));
+  for (auto i = 0; i < 10; i++) {
+    ASSERT_EQ(i, list.at(i));
+  }
+}
+
+TEST_F(DoublyCircularListTest, RotateMovesFrontToBack) {
+  list.rotate();
+  for (auto i = 0; i < 5; i++) {
+    list.push_back(i);
+  }
+  list.rotate();
+  list.rotate(3);
+  list.rotate(10);
+  list.rotate(7);
+  for (auto i = 0; i < 5; i++) {
+    ASSERT_EQ((i + 6) % 5, list.at(i));
+  }
+  ASSERT_EQ(0, list.pop_back());
+  ASSERT_EQ(1, list.pop_front());
+}
+
+TEST_F(DoublyCircularListTest, SpliceMovesRanges) {
+  structures::DoublyCircularList<int, std::allocator<int>> standard{};
+  structures::DoublyCircularList<int, std::allocator<int>> source{};
+  for (auto i = 0; i < 6; i++) {
+    list.push_back(i);
+    source.push_back(i);
+  }
+  standard.push_back(-1);
+  standard.push_back(-2);
+  standard.splice(1, source, 2, 5);
+  ASSERT_EQ(3u, source.size());
+  ASSERT_EQ(5u, standard.size());
+  for (auto i = 0; i < 3; i++) {
+    ASSERT_EQ(i + 2, standard.at(i + 1));
+  }
+  ASSERT_EQ(-2, standard.at(4));
+
+  structures::DoublyCircularList<int> other{};
+  other.splice(0, list, 4, 6);
+  other.splice(0, list, 0, 1);
+  ASSERT_EQ(3u, list.size());
+  ASSERT_EQ(0, other.at(0));
+  ASSERT_EQ(5, other.at(2));
+  ASSERT_THROW(other.splice(0, other, 0, 1), std::invalid_argument);
+  ASSERT_THROW(other.splice(4, list, 0, 1), std::out_of_range);
+  ASSERT_THROW(other.splice(0, list, 2, 4), std::out_of_range);
+}
+
+TEST_F(DoublyCircularListTest, SpliceRangeRelinksPooledNodes) {
+  for (auto i = 0; i < 100; i++) {
+    list.push_back(i);
+  }
+  const int* moved[4];
+  {
+    structures::DoublyCircularList<int> other{};
+    other.push_back(-1);
+    for (auto i = 0; i < 4; i++) {
+      moved[i] = &list.at(i + 10);
+    }
+    other.splice(1, list, 10, 14);
+    ASSERT_EQ(96u, list.size());
+    ASSERT_EQ(5u, other.size());
+    for (auto i = 0; i < 4; i++) {
+      ASSERT_EQ(moved[i], &other.at(i + 1));
+    }
+    list.splice(0, other, 1, 5);
+    other.push_back(-2);
+  }
+  for (auto i = 0; i < 4; i++) {
+    ASSERT_EQ(moved[i], &list.at(i));
+    ASSERT_EQ(i + 10, list.at(i));
+  }
+  for (auto i = 0; i < 100; i++) {
+    list.push_back(i);
+  }
+  ASSERT_EQ(200u, list.size());
+}
+
+TEST_F(DoublyCircularListTest, SpliceWholeListAdoptsNodes) {
+  for (auto i = 0; i < 100; i++) {
+    list.push_back(i);
+  }
+  {
+    structures::DoublyCircularList<int> other{};
+    other.push_back(-1);
+    other.push_back(-2);
+    other.splice(1, list);
+    ASSERT_TRUE(list.empty());
+    list.push_back(0);
+    other.pop_back();
+    list.splice(0, other);
+    ASSERT_TRUE(other.empty());
+    other.push_back(0);
+  }
+  ASSERT_EQ(102u, list.size());
+  ASSERT_EQ(-1, list.pop_front());
+  ASSERT_EQ(0, list.pop_front());
+  ASSERT_EQ(0, list.pop_back());
+  ASSERT_EQ(99, list.pop_back());
+}
+
+TEST_F(DoublyCircularListTest, EmptyListDoesNotAllocate) {
+  ASSERT_TRUE(std::is_nothrow_default_constructible<
+              structures::DoublyCircularList<std::string>>::value);
+  structures::DoublyCircularList<std::string> strings{};
+  structures::DoublyCircularList<std::string> moved{std::move(strings)};
+  ASSERT_TRUE(moved.empty());
+  ASSERT_THROW(moved.pop_back(), std::out_of_range);
+}
+
+TEST_F(DoublyCircularListTest, MovedListsKeepTheirOwnSentinels) {
+  for (auto i = 0; i < 3; i++) {
+    list.push_back(i);
+  }
+  structures::DoublyCircularList<int> moved{std::move(list)};
+  moved.push_back(3);
+  list.push_back(-1);
+  ASSERT_EQ(1u, list.size());
+  ASSERT_EQ(-1, list.at(0));
+  list = std::move(moved);
+  list.rotate(2);
+  ASSERT_EQ(4u, list.size());
+  for (auto i = 0; i < 4; i++) {
+    ASSERT_EQ((i + 2) % 4, list.pop_front());
+  }
+}
@@ -0,0 +1,49 @@
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "doubly_linked_list.h"
+
+// Acesso por índice (at) a uma DoublyLinkedList<int> de SIZE elementos, em
+// três padrões: sequencial (0, 1, 2, ...), aleatório e próximo ao fim (os
+// últimos NEAR_END elementos). Reporta o tempo médio por acesso.
+
+namespace {
+const std::size_t SIZE = 20000;
+const std::size_t RANDOM_ACCESSES = 20000;
+const std::size_t NEAR_END = 16;
+
+template <typename F>
+void run(const char* name, std::size_t accesses, F access) {
+  auto start = std::chrono::steady_clock::now();
+  long sum = 0;
+  for (std::size_t i = 0; i != accesses; i++) {
+    sum += access(i);
+  }
+  auto end = std::chrono::steady_clock::now();
+  std::chrono::duration<double, std::nano> elapsed = end - start;
+  std::printf("%-12s %12.1f %12ld\n", name, elapsed.count() / accesses, sum);
+}
+}  // namespace
+
+int main(void) {
+  structures::DoublyLinkedList<int> list;
+  for (std::size_t i = 0; i != SIZE; i++) {
+    list.push_front(static_cast<int>(SIZE - 1 - i));
+  }
+  std::mt19937 generator{42};
+  std::uniform_int_distribution<std::size_t> distribution{0, SIZE - 1};
+  std::vector<std::size_t> keys(RANDOM_ACCESSES);
+  for (auto& key : keys) {
+    key = distribution(generator);
+  }
+
+  std::printf("%-12s %12s %12s\n", "pattern", "ns/access", "checksum");
+  run("sequential", SIZE, [&](std::size_t i) { return list.at(i); });
+  run("random", RANDOM_ACCESSES,
+      [&](std::size_t i) { return list.at(keys[i]); });
+  run("near-end", SIZE,
+      [&](std::size_t i) { return list.at(SIZE - 1 - i % NEAR_END); });
+  return 0;
+}
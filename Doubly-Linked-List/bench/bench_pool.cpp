@@ -0,0 +1,66 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+#include "doubly_linked_list.h"
+
+// Rotatividade de uma DoublyLinkedList<int> com WORKING_SET elementos: cada
+// operação insere e remove um elemento (fila: push_back e pop_front). Compara o
+// PoolAllocator padrão com std::allocator, contando as chamadas ao alocador
+// global com a substituição do operator new.
+
+namespace {
+std::size_t allocations = 0;
+
+const std::size_t WORKING_SET = 1000;
+const std::size_t OPERATIONS = 10000000;
+}  // namespace
+
+void* operator new(std::size_t size) {
+  allocations++;
+  void* pointer = std::malloc(size == 0 ? 1 : size);
+  if (pointer == nullptr) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+
+void operator delete(void* pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+
+namespace {
+template <typename List>
+long churn(const char* name) {
+  std::size_t before = allocations;
+  auto start = std::chrono::steady_clock::now();
+  long sum = 0;
+  {
+    List list;
+    for (std::size_t i = 0; i != WORKING_SET; i++) {
+      list.push_back(static_cast<int>(i));
+    }
+    for (std::size_t i = 0; i != OPERATIONS; i++) {
+      list.push_back(static_cast<int>(i));
+      sum += list.pop_front();
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+  std::chrono::duration<double> elapsed = end - start;
+  std::printf("%-16s %14.0f %12zu\n", name, OPERATIONS / elapsed.count(),
+              allocations - before);
+  return sum;
+}
+}  // namespace
+
+int main(void) {
+  std::printf("%-16s %14s %12s\n", "allocator", "ops/s", "allocations");
+  long sum = churn<structures::DoublyLinkedList<int>>("PoolAllocator");
+  sum -= churn<structures::DoublyLinkedList<int, std::allocator<int>>>(
+      "std::allocator");
+  return sum != 0;
+}
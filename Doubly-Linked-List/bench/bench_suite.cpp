@@ -0,0 +1,39 @@
+#include <vector>
+
+#include "benchmark.h"
+#include "doubly_linked_list.h"
+
+// Suíte de desempenho da DoublyLinkedList (ver benchmark::Suite). Para cada
+// tamanho: insert (push_front), insert_back (push_back), lookup (contains de
+// chaves aleatórias), traverse (uma busca sem sucesso, que percorre todos os
+// nós, por operação) e remove (pop_front).
+
+namespace {
+const char* const CONTAINER = "DoublyLinkedList";
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  benchmark::Suite suite{argc, argv};
+  for (auto size : suite.sizes()) {
+    structures::DoublyLinkedList<int> list;
+    suite.measure(CONTAINER, "insert", size, size,
+                  [&](std::size_t i) { list.push_front(static_cast<int>(i)); });
+
+    std::size_t appends = suite.operations(size, benchmark::CONSTANT);
+    suite.measure(CONTAINER, "insert_back", size, appends,
+                  [&](std::size_t i) { list.push_back(static_cast<int>(i)); });
+
+    std::size_t lookups = suite.operations(size, benchmark::LINEAR);
+    std::vector<int> keys = benchmark::random_keys(lookups, size);
+    suite.measure(CONTAINER, "lookup", size, lookups, [&](std::size_t i) {
+      benchmark::keep(list.contains(keys[i]));
+    });
+
+    suite.measure(CONTAINER, "traverse", size, lookups,
+                  [&](std::size_t) { benchmark::keep(list.find(-1)); });
+
+    suite.measure(CONTAINER, "remove", size, size,
+                  [&](std::size_t) { benchmark::keep(list.pop_front()); });
+  }
+  return 0;
+}
@@ -2,9 +2,14 @@
 #define STRUCTURES_LINKED_LIST_H
 
 #include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "pool_allocator.h"
 
 namespace structures {
-template <typename T>
+template <typename T, typename Allocator = PoolAllocator<T>>
 //! Classe DoublyLinkedList
 /*!
    Classe lista encadeada dupla com tipo genérico.
@@ -17,12 +22,29 @@ class DoublyLinkedList {
    */
   DoublyLinkedList(void);
 
+  //! Construtor de movimento
+  /*!
+     Cria uma lista tomando para si os nodos de other, sem copiar os dados.
+     other fica vazia.
+     \param other: Lista de origem (DoublyLinkedList&&).
+   */
+  DoublyLinkedList(DoublyLinkedList&& other);
+
   //! Destrutor
   /*!
      Destrutor da lista encadeada.
    */
   ~DoublyLinkedList(void);
 
+  //! Atribuição por movimento
+  /*!
+     Remove os elementos atuais e toma para si os nodos de other, sem copiar os
+     dados. other fica vazia.
+     \param other: Lista de origem (DoublyLinkedList&&).
+     \return Referência para esta lista (DoublyLinkedList&).
+   */
+  DoublyLinkedList& operator=(DoublyLinkedList&& other);
+
   //! Método limpa
   /*!
      Limpa a lista.
@@ -32,12 +54,32 @@ class DoublyLinkedList {
   //! Método adiciona no fim da lista
   /*!
      Adiciona elemento (data) no fim da lista, se houver espaço. Se não houver
-     espaço, lança exceção (out_of_range).
+     espaço, lança exceção (out_of_range). Custa tempo constante.
      \param data: Referência constante para o elemento a ser adicionado na lista
      (const T&).
    */
   void push_back(const T& data);
 
+  //! Método adiciona no fim da lista (movimento)
+  /*!
+     Como push_back(const T&), mas move data para o novo nodo em vez de
+     copiá-lo.
+     \param data: Elemento a ser movido para a lista (T&&).
+   */
+  void push_back(T&& data);
+
+  //! Método constrói no fim da lista
+  /*!
+     Constrói o elemento diretamente em um novo nodo no fim da lista,
+     repassando args ao construtor de T, sem cópias nem movimentos.
+     \param args: Argumentos repassados ao construtor de T.
+     \return Referência ao elemento adicionado (T&).
+   */
+  template <typename... Args>
+  T& emplace_back(Args&&... args) {
+    return emplace(size_, std::forward<Args>(args)...);
+  }
+
   //! Método adiciona no início da lista
   /*!
      Adiciona elemento (data) no início da lista, se houver espaço. Se não
@@ -47,16 +89,63 @@ class DoublyLinkedList {
    */
   void push_front(const T& data);
 
+  //! Método adiciona no início da lista (movimento)
+  /*!
+     Como push_front(const T&), mas move data para o novo nodo em vez de
+     copiá-lo.
+     \param data: Elemento a ser movido para a lista (T&&).
+   */
+  void push_front(T&& data);
+
+  //! Método constrói no início da lista
+  /*!
+     Como emplace_back, mas adiciona o elemento no início da lista.
+     \param args: Argumentos repassados ao construtor de T.
+     \return Referência ao elemento adicionado (T&).
+   */
+  template <typename... Args>
+  T& emplace_front(Args&&... args) {
+    return emplace(0u, std::forward<Args>(args)...);
+  }
+
   //! Método insere na posição
   /*!
      Insere elemento (data) em uma dada posição da lista (index), se houver
      espaço e se a posição passada for uma posição válida. Caso não há espaço,
-     ou a posição não é válida, lança exceção (out_of_range).
+     ou a posição não é válida, lança exceção (out_of_range). A posição é
+     alcançada a partir do ponto mais próximo: início, fim ou último acesso.
      \param data: Referência constante para o elemento a ser inserido (const
      T&). \param index: Posição para inserir o elemento (size_t).
    */
   void insert(const T& data, std::size_t index);
 
+  //! Método insere na posição (movimento)
+  /*!
+     Como insert(const T&, size_t), mas move data para o novo nodo em vez de
+     copiá-lo.
+     \param data: Elemento a ser movido para a lista (T&&).
+     \param index: Posição para inserir o elemento (size_t).
+   */
+  void insert(T&& data, std::size_t index);
+
+  //! Método constrói na posição
+  /*!
+     Como emplace_back, mas insere o elemento na posição index. Se a posição
+     não for válida, lança exceção (out_of_range) sem construir o elemento.
+     \param index: Posição para inserir o elemento (size_t).
+     \param args: Argumentos repassados ao construtor de T.
+     \return Referência ao elemento inserido (T&).
+   */
+  template <typename... Args>
+  T& emplace(std::size_t index, Args&&... args) {
+    if (index > size_) {
+      throw std::out_of_range("Invalid index");
+    }
+    Node* new_node = make_node(std::forward<Args>(args)...);
+    insert_node(new_node, index);
+    return new_node->data();
+  }
+
   //! Método insere ordenado
   /*!
      Insere elemento (data) em ordem na lista (caso a lista possua ordem). Se
@@ -70,9 +159,9 @@ class DoublyLinkedList {
   /*!
      Remove elemento na posição passada (index), se houver elementos e se a
      posição for válida. Se não há elementos ou a posição não é válida, lança
-     exceção (out_of_range).
+     exceção (out_of_range). Como insert, parte do ponto mais próximo.
      \param index: Posição do elemento a ser removido (size_t).
-     \return Elemento removido (T)
+     \return Elemento removido, movido para fora do nodo (T).
    */
   T pop(std::size_t index);
 
@@ -80,7 +169,7 @@ class DoublyLinkedList {
   /*!
      Remove elemento no final da lista, se houver elementos. Se não houver
      elementos, lança exceção (out_of_range).
-     \return Elemento removido (T).
+     \return Elemento removido, movido para fora do nodo (T).
    */
   T pop_back(void);
 
@@ -89,7 +178,7 @@ class DoublyLinkedList {
      Remove elemento no início da lista e move os elementos restantes "um passo
      para frente", se houver elementos. Se não houver elementos, lança exceção
      (out_of_range).
-     \return Elemento removido (T)
+     \return Elemento removido, movido para fora do nodo (T).
    */
   T pop_front(void);
 
@@ -121,10 +210,12 @@ class DoublyLinkedList {
    */
   bool contains(const T& data) const;
 
-  //! Sobrecarga do operador []
+  //! Método "em"
   /*!
      Retorna referência ao elemento na posição (index). Caso o índice seja
-     inválido lança exceção (out_of_range).
+     inválido lança exceção (out_of_range). Parte do ponto mais próximo entre
+     o início, o fim e a posição do último acesso; acessos sequenciais custam
+     tempo constante.
      \param index: Posição do elemento a ser retornado (size_t).
      \return Referência ao elemento na posição (const T&).
    */
@@ -186,6 +277,12 @@ class DoublyLinkedList {
     Node(const T& data, Node* previous, Node* next)
         : data_{data}, previous_{previous}, next_{next} {}
 
+    template <typename... Args>
+    explicit Node(std::in_place_t, Args&&... args)
+        : data_(std::forward<Args>(args)...),
+          previous_{nullptr},
+          next_{nullptr} {}
+
     T& data(void) { return data_; };
 
     const T& data(void) const { return data_; }
@@ -208,22 +305,111 @@ class DoublyLinkedList {
     Node* next_;
   };
 
-  Node* node(std::size_t index) {
-    Node* node = head_;
+  //! Alocador de nodos
+  using NodeAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+
+  //! Operações do alocador de nodos
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
 
-    for (std::size_t i = 0; i < size(); i++) {
-      if (i == index) {
-        return node;
+  //! Método cria nodo
+  /*!
+     Obtém um nodo do alocador e constrói nele o dado, repassando args ao
+     construtor de T. Se a construção lançar exceção, devolve o nodo ao
+     alocador.
+     \param args: Argumentos repassados ao construtor de T.
+     \return Nodo criado, ainda não encadeado (Node *).
+   */
+  template <typename... Args>
+  Node* make_node(Args&&... args) {
+    Node* node = NodeTraits::allocate(allocator_, 1);
+    try {
+      NodeTraits::construct(allocator_, node, std::in_place,
+                            std::forward<Args>(args)...);
+    } catch (...) {
+      NodeTraits::deallocate(allocator_, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  //! Método destrói nodo
+  /*!
+     Destrói o dado do nodo e devolve o nodo ao alocador.
+     \param node: Nodo já desencadeado (Node *).
+   */
+  void destroy_node(Node* node);
+
+  //! Método insere nodo
+  /*!
+     Encadeia um nodo já construído na posição index, que deve ser válida.
+     \param new_node: Nodo a ser inserido (Node *).
+     \param index: Posição do nodo na lista (size_t).
+   */
+  void insert_node(Node* new_node, std::size_t index);
+
+  //! Método nodo
+  /*!
+     Retorna o nodo na posição index, que deve ser válida. Parte do ponto
+     mais próximo entre o início, o fim e o cursor, e caminha na direção
+     necessária. Ao final, o cursor passa a apontar para o nodo retornado.
+     \param index: Posição do nodo (size_t).
+     \return Nodo na posição (Node *).
+   */
+  Node* node(std::size_t index) const {
+    Node* current = head_;
+    std::size_t position = 0u;
+    std::size_t distance = index;
+
+    if (size_ - 1 - index < distance) {
+      current = tail_;
+      position = size_ - 1;
+      distance = size_ - 1 - index;
+    }
+    if (cursor_ != nullptr) {
+      std::size_t from_cursor = index > cursor_index_ ? index - cursor_index_
+                                                      : cursor_index_ - index;
+      if (from_cursor < distance) {
+        current = cursor_;
+        position = cursor_index_;
       }
-      node = node->next();
     }
 
-    return node;
+    while (position < index) {
+      current = current->next();
+      position++;
+    }
+    while (position > index) {
+      current = current->previous();
+      position--;
+    }
+
+    cursor_ = current;
+    cursor_index_ = index;
+    return current;
   }
 
   Node* head_;
 
+  //! Último nodo da lista, ou nullptr se ela estiver vazia
+  Node* tail_{nullptr};
+
+  //! Cursor
+  /*!
+     Último nodo acessado por posição, ou nullptr. Torna constante o custo de
+     acessos sequenciais por índice (at(i), at(i + 1), ...). Como é alterado
+     também por métodos const, leituras concorrentes da mesma lista exigem
+     sincronização externa.
+   */
+  mutable Node* cursor_{nullptr};
+
+  //! Posição do nodo apontado pelo cursor
+  mutable std::size_t cursor_index_{0u};
+
   std::size_t size_;
+
+  //! Alocador dos nodos da lista
+  NodeAllocator allocator_;
 };
 }  // namespace structures
 
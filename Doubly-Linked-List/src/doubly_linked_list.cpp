@@ -1,76 +1,93 @@
 #include "doubly_linked_list.h"
 
+#include <memory>
 #include <stdexcept>
+#include <string>
+#include <utility>
 
-template<typename T>
-structures::DoublyLinkedList<T>::DoublyLinkedList(void) {
+template <typename T, typename Allocator>
+structures::DoublyLinkedList<T, Allocator>::DoublyLinkedList(void) {
   head_ = nullptr;
   size_ = 0u;
 }
 
-template<typename T>
-structures::DoublyLinkedList<T>::~DoublyLinkedList(void) {
+template <typename T, typename Allocator>
+structures::DoublyLinkedList<T, Allocator>::DoublyLinkedList(
+    DoublyLinkedList&& other)
+    : allocator_{std::move(other.allocator_)} {
+  head_ = other.head_;
+  tail_ = other.tail_;
+  size_ = other.size_;
+  other.head_ = nullptr;
+  other.tail_ = nullptr;
+  other.cursor_ = nullptr;
+  other.size_ = 0u;
+}
+
+template <typename T, typename Allocator>
+structures::DoublyLinkedList<T, Allocator>::~DoublyLinkedList(void) {
   clear();
 }
 
-template<typename T>
-void structures::DoublyLinkedList<T>::clear(void) {
+template <typename T, typename Allocator>
+structures::DoublyLinkedList<T, Allocator>&
+structures::DoublyLinkedList<T, Allocator>::operator=(
+    DoublyLinkedList&& other) {
+  if (this != &other) {
+    clear();
+    allocator_ = std::move(other.allocator_);
+    head_ = other.head_;
+    tail_ = other.tail_;
+    size_ = other.size_;
+    other.head_ = nullptr;
+    other.tail_ = nullptr;
+    other.cursor_ = nullptr;
+    other.size_ = 0u;
+  }
+  return *this;
+}
+
+template <typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::clear(void) {
   while (!empty()) {
     pop_front();
   }
 }
 
-template <typename T>
-void structures::DoublyLinkedList<T>::push_back(const T& data) {
-  insert(data, size_);
+template <typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::push_back(const T& data) {
+  emplace_back(data);
 }
 
-template <typename T>
-void structures::DoublyLinkedList<T>::push_front(const T& data) {
-  Node* new_node = new Node(data, head_);
-
-  if (new_node == nullptr) {
-    delete new_node;
-    throw std::out_of_range("Cannot push front on full list");
-  }
-
-  if (head_ != nullptr) {
-    head_->previous(new_node);
-  }
-
-  head_ = new_node;
-  size_++;
+template <typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::push_back(T&& data) {
+  emplace_back(std::move(data));
 }
 
-template<typename T>
-void structures::DoublyLinkedList<T>::insert(const T& data, std::size_t index) {
-  if (index > size_) {
-    throw std::out_of_range("Invalid Index");
-  } else if (index == 0) {
-    push_front(data);
-  } else {
-    Node* new_node = new Node(data);
-    Node* before = node(index -1);
-
-    if (new_node == nullptr) {
-      throw std::out_of_range("Full list");
-    }
-
+template <typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::push_front(const T& data) {
+  emplace_front(data);
+}
 
-    new_node->next(before->next());
-    before->next(new_node);
-    new_node->previous(before);
+template <typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::push_front(T&& data) {
+  emplace_front(std::move(data));
+}
 
-    if (new_node->next() != nullptr) {
-      new_node->next()->previous(new_node);
-    }
+template <typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::insert(const T& data,
+                                                        std::size_t index) {
+  emplace(index, data);
+}
 
-    size_ ++;
-  }
+template <typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::insert(T&& data,
+                                                        std::size_t index) {
+  emplace(index, std::move(data));
 }
 
-template <typename T>
-void structures::DoublyLinkedList<T>::insert_sorted(const T& data) {
+template <typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::insert_sorted(const T& data) {
   if (empty()) {
     push_front(data);
   } else {
@@ -89,13 +106,13 @@ void structures::DoublyLinkedList<T>::insert_sorted(const T& data) {
   }
 }
 
-template<typename T>
-T structures::DoublyLinkedList<T>::pop_back(void) {
+template <typename T, typename Allocator>
+T structures::DoublyLinkedList<T, Allocator>::pop_back(void) {
   return pop(size_ - 1);
 }
 
-template<typename T>
-T structures::DoublyLinkedList<T>::pop_front(void) {
+template <typename T, typename Allocator>
+T structures::DoublyLinkedList<T, Allocator>::pop_front(void) {
   if (empty()) {
     throw std::out_of_range("Cannot pop from empty list");
   }
@@ -104,15 +121,25 @@ T structures::DoublyLinkedList<T>::pop_front(void) {
   out = head_;
 
   head_ = out->next();
-  T data = out->data();
+  if (head_ != nullptr) {
+    head_->previous(nullptr);
+  } else {
+    tail_ = nullptr;
+  }
+  if (cursor_ == out) {
+    cursor_ = nullptr;
+  } else if (cursor_ != nullptr) {
+    cursor_index_--;
+  }
+  T data = std::move(out->data());
   size_--;
-  delete out;
+  destroy_node(out);
 
   return data;
 }
 
-template<typename T>
-T structures::DoublyLinkedList<T>::pop(std::size_t index) {
+template <typename T, typename Allocator>
+T structures::DoublyLinkedList<T, Allocator>::pop(std::size_t index) {
   if (empty()) {
     throw std::out_of_range("Empty List");
   }
@@ -129,71 +156,68 @@ T structures::DoublyLinkedList<T>::pop(std::size_t index) {
   Node* after = out->next();
   Node* before = out->previous();
 
-  if (before != nullptr) {
-    before->next(after);
-  }
-
+  before->next(after);
   if (after != nullptr) {
     after->previous(before);
+  } else {
+    tail_ = before;
   }
+  // O cursor apontava para out; passa ao anterior, que continua válido.
+  cursor_ = before;
+  cursor_index_ = index - 1;
 
-  T data = out->data();
+  T data = std::move(out->data());
   size_--;
-  delete out;
+  destroy_node(out);
 
   return data;
 }
 
-template<typename T>
-void structures::DoublyLinkedList<T>::remove(const T& data) {
+template <typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::remove(const T& data) {
   pop(find(data));
 }
 
-template <typename T>
-bool structures::DoublyLinkedList<T>::empty(void) const {
+template <typename T, typename Allocator>
+bool structures::DoublyLinkedList<T, Allocator>::empty(void) const {
   return size_ == 0u;
 }
 
-template <typename T>
-bool structures::DoublyLinkedList<T>::contains(const T& data) const {
+template <typename T, typename Allocator>
+bool structures::DoublyLinkedList<T, Allocator>::contains(const T& data) const {
   return find(data) != size();
 }
 
-template <typename T>
-T& structures::DoublyLinkedList<T>::at(std::size_t index) {
+template <typename T, typename Allocator>
+T& structures::DoublyLinkedList<T, Allocator>::at(std::size_t index) {
   return const_cast<T&>(static_cast<const DoublyLinkedList*>(this)->at(index));
 }
 
-template <typename T>
-const T& structures::DoublyLinkedList<T>::at(std::size_t index) const {
+template <typename T, typename Allocator>
+const T& structures::DoublyLinkedList<T, Allocator>::at(
+    std::size_t index) const {
   if (empty()) {
     throw std::out_of_range("List is empty");
   } else if (index >= size_) {
     throw std::out_of_range("Index out of bounds");
   }
-  Node* current = head_;
-  auto i = 0;
-
-  while (i != index) {
-    current = current->next();
-    i++;
-  }
-
-  return current->data();
+  return node(index)->data();
 }
 
-template <typename T>
-T& structures::DoublyLinkedList<T>::operator[](std::size_t index) {
+template <typename T, typename Allocator>
+T& structures::DoublyLinkedList<T, Allocator>::operator[](std::size_t index) {
   return at(index);
 }
 
-template <typename T>
-const T& structures::DoublyLinkedList<T>::operator[](std::size_t index) const {
+template <typename T, typename Allocator>
+const T& structures::DoublyLinkedList<T, Allocator>::operator[](
+    std::size_t index) const {
   return const_cast<T&>(static_cast<const DoublyLinkedList*>(this)->at(index));
 }
 
-template <typename T>
-std::size_t structures::DoublyLinkedList<T>::find(const T& data) const {
+template <typename T, typename Allocator>
+std::size_t structures::DoublyLinkedList<T, Allocator>::find(
+    const T& data) const {
   if (empty()) {
     throw std::out_of_range("List is empty");
   }
@@ -210,9 +234,46 @@ std::size_t structures::DoublyLinkedList<T>::find(const T& data) const {
   return index;
 }
 
-template <typename T>
-std::size_t structures::DoublyLinkedList<T>::size(void) const {
+template <typename T, typename Allocator>
+std::size_t structures::DoublyLinkedList<T, Allocator>::size(void) const {
   return size_;
 }
 
+template <typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::insert_node(
+    Node* new_node, std::size_t index) {
+  if (index == 0) {
+    new_node->next(head_);
+    if (head_ != nullptr) {
+      head_->previous(new_node);
+    } else {
+      tail_ = new_node;
+    }
+    head_ = new_node;
+  } else {
+    Node* before = index == size_ ? tail_ : node(index - 1);
+    Node* after = before->next();
+    new_node->next(after);
+    new_node->previous(before);
+    before->next(new_node);
+    if (after != nullptr) {
+      after->previous(new_node);
+    } else {
+      tail_ = new_node;
+    }
+  }
+  if (cursor_ != nullptr && cursor_index_ >= index) {
+    cursor_index_++;
+  }
+  size_++;
+}
+
+template <typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::destroy_node(Node* node) {
+  NodeTraits::destroy(allocator_, node);
+  NodeTraits::deallocate(allocator_, node, 1);
+}
+
 template class structures::DoublyLinkedList<int>;
+template class structures::DoublyLinkedList<int, std::allocator<int>>;
+template class structures::DoublyLinkedList<std::string>;
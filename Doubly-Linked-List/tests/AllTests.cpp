@@ -1,3 +1,9 @@
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "gtest/gtest.h"
 #include "doubly_linked_list.h"
 
@@ -237,3 +243,158 @@ TEST_F(DoublyLinkedListTest, RemovePopsData) {
   list.remove(9);
   ASSERT_FALSE(list.contains(9));
 }
+
+TEST_F(DoublyLinkedListTest, MoveConstructorTakesNodes) {
+  for (auto i = 0; i < 10; i++) {
+    list.push_back(i);
+  }
+  structures::DoublyLinkedList<int> moved{std::move(list)};
+  ASSERT_EQ(10u, moved.size());
+  ASSERT_EQ(0, moved.at(0));
+  ASSERT_EQ(9, moved.at(9));
+  ASSERT_TRUE(list.empty());
+  list.push_back(1);
+  ASSERT_EQ(1, list.at(0));
+}
+
+TEST_F(DoublyLinkedListTest, MoveAssignmentReplacesNodes) {
+  structures::DoublyLinkedList<int> other{};
+  other.push_back(1);
+  other.push_back(2);
+  list.push_back(-1);
+  list = std::move(other);
+  ASSERT_EQ(2u, list.size());
+  ASSERT_EQ(1, list.at(0));
+  ASSERT_EQ(2, list.at(1));
+  ASSERT_TRUE(other.empty());
+}
+
+TEST_F(DoublyLinkedListTest, PushRvalueMovesStrings) {
+  structures::DoublyLinkedList<std::string> strings{};
+  std::string back(64, 'b');
+  std::string front(64, 'f');
+  strings.push_back(std::move(back));
+  strings.push_front(std::move(front));
+  strings.insert(std::string(64, 'i'), 1);
+  ASSERT_TRUE(back.empty());
+  ASSERT_TRUE(front.empty());
+  ASSERT_EQ(std::string(64, 'f'), strings.at(0));
+  ASSERT_EQ(std::string(64, 'i'), strings.at(1));
+  ASSERT_EQ(std::string(64, 'b'), strings.at(2));
+}
+
+TEST_F(DoublyLinkedListTest, EmplaceConstructsInNodes) {
+  structures::DoublyLinkedList<std::string> strings{};
+  ASSERT_EQ("bbb", strings.emplace_back(3u, 'b'));
+  ASSERT_EQ("a", strings.emplace_front("a"));
+  strings.emplace(1, 2u, 'x') += "y";
+  ASSERT_EQ(3u, strings.size());
+  ASSERT_EQ("a", strings.at(0));
+  ASSERT_EQ("xxy", strings.at(1));
+  ASSERT_EQ("bbb", strings.at(2));
+  ASSERT_THROW(strings.emplace(4, "z"), std::out_of_range);
+  ASSERT_EQ(3u, strings.size());
+}
+
+TEST_F(DoublyLinkedListTest, PopMovesDataOut) {
+  structures::DoublyLinkedList<std::string> strings{};
+  strings.push_back(std::string(64, 'a'));
+  strings.push_back(std::string(64, 'b'));
+  strings.push_back(std::string(64, 'c'));
+  ASSERT_EQ(std::string(64, 'b'), strings.pop(1));
+  ASSERT_EQ(std::string(64, 'c'), strings.pop_back());
+  ASSERT_EQ(std::string(64, 'a'), strings.pop_front());
+  ASSERT_TRUE(strings.empty());
+}
+
+TEST_F(DoublyLinkedListTest, PoolReusesRemovedNodes) {
+  list.push_back(1);
+  const int* first = &list.at(0);
+  list.pop_front();
+  list.push_back(2);
+  ASSERT_EQ(first, &list.at(0));
+}
+
+TEST_F(DoublyLinkedListTest, MovedListKeepsNodesOfItsPool) {
+  for (auto i = 0; i < 100; i++) {
+    list.push_back(i);
+  }
+  structures::DoublyLinkedList<int> other{};
+  other.push_back(-1);
+  other = std::move(list);
+  structures::DoublyLinkedList<int> moved{std::move(other)};
+  list.push_back(0);
+  other.push_back(0);
+  ASSERT_EQ(100u, moved.size());
+  ASSERT_EQ(99, moved.pop_back());
+  ASSERT_EQ(0, moved.pop_front());
+}
+
+TEST_F(DoublyLinkedListTest, WorksWithStandardAllocator) {
+  structures::DoublyLinkedList<int, std::allocator<int>> standard{};
+  standard.push_back(1);
+  standard.push_front(0);
+  standard.insert(2, 2);
+  structures::DoublyLinkedList<int, std::allocator<int>> moved{std::move(standard)};
+  ASSERT_TRUE(standard.empty());
+  ASSERT_EQ(3u, moved.size());
+  for (auto i = 0; i < 3; i++) {
+    ASSERT_EQ(i, moved.pop_front());
+  }
+}
+
+TEST_F(DoublyLinkedListTest, AtReachesBothEnds) {
+  for (auto i = 0; i < 10; i++) {
+    list.push_back(i);
+  }
+  ASSERT_EQ(9, list.at(9));
+  ASSERT_EQ(8, list.at(8));
+  ASSERT_EQ(0, list.at(0));
+  ASSERT_EQ(5, list.at(5));
+  ASSERT_EQ(4, list.at(4));
+}
+
+TEST_F(DoublyLinkedListTest, PopsKeepBothEndsLinked) {
+  for (auto i = 0; i < 4; i++) {
+    list.push_back(i);
+  }
+  ASSERT_EQ(0, list.pop_front());
+  ASSERT_EQ(3, list.pop_back());
+  list.push_front(-1);
+  list.push_back(4);
+  ASSERT_EQ(4, list.pop(3));
+  ASSERT_EQ(2, list.pop_back());
+  ASSERT_EQ(1, list.pop_back());
+  ASSERT_EQ(-1, list.pop_back());
+  ASSERT_TRUE(list.empty());
+  list.push_back(7);
+  ASSERT_EQ(7, list.at(0));
+}
+
+TEST_F(DoublyLinkedListTest, IndexedAccessMatchesVectorAfterEdits) {
+  std::vector<int> expected;
+  std::mt19937 generator{42};
+  for (auto step = 0; step < 2000; step++) {
+    std::size_t index = generator() % (expected.size() + 1);
+    switch (generator() % 3) {
+      case 0:
+        list.insert(step, index);
+        expected.insert(expected.begin() + index, step);
+        break;
+      case 1:
+        if (index < expected.size()) {
+          ASSERT_EQ(expected[index], list.pop(index));
+          expected.erase(expected.begin() + index);
+        }
+        break;
+      default:
+        if (index < expected.size()) {
+          ASSERT_EQ(expected[index], list.at(index));
+        }
+    }
+  }
+  ASSERT_EQ(expected.size(), list.size());
+  for (std::size_t i = 0; i < expected.size(); i++) {
+    ASSERT_EQ(expected[i], list[i]);
+  }
+}
@@ -0,0 +1,54 @@
+#include <chrono>
+#include <cstdio>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "linked_list.h"
+
+// Construção de listas de até 1M elementos pelo fim. Compara push_back, que
+// usa o ponteiro de cauda, com append de um intervalo (nodos encadeados de
+// uma só vez) e append de outra lista (apenas os ponteiros são ajustados).
+// Antes da cauda, push_back percorria a lista inteira e construir n elementos
+// custava O(n²).
+
+namespace {
+const std::size_t SIZES[] = {10000u, 100000u, 1000000u};
+
+template <typename F>
+double measure(F operation) {
+  auto start = std::chrono::steady_clock::now();
+  operation();
+  auto end = std::chrono::steady_clock::now();
+  std::chrono::duration<double, std::milli> elapsed = end - start;
+  return elapsed.count();
+}
+}  // namespace
+
+int main(void) {
+  std::printf("%-10s %14s %14s %14s\n", "size", "push_back ms", "append ms",
+              "splice ms");
+  std::size_t total = 0;
+  for (auto size : SIZES) {
+    std::vector<int> values(size);
+    std::iota(values.begin(), values.end(), 0);
+
+    structures::LinkedList<int> pushed;
+    double push = measure([&] {
+      for (auto value : values) {
+        pushed.push_back(value);
+      }
+    });
+
+    structures::LinkedList<int> appended;
+    double append =
+        measure([&] { appended.append(values.begin(), values.end()); });
+
+    structures::LinkedList<int> spliced;
+    double splice = measure([&] { spliced.append(std::move(appended)); });
+
+    std::printf("%-10zu %14.2f %14.2f %14.4f\n", size, push, append, splice);
+    total += pushed.size() + spliced.size();
+  }
+  return total == 0;
+}
@@ -2,9 +2,20 @@
 #define STRUCTURES_LINKED_LIST_H
 
 #include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "pool_allocator.h"
 
 namespace structures {
-template <typename T>
+//! Classe LinkedList
+/*!
+   Lista encadeada simples. Os nodos são obtidos de Allocator (reassociado ao
+   tipo do nodo); o padrão, PoolAllocator, reaproveita os nodos removidos em
+   blocos próprios de cada lista.
+ */
+template <typename T, typename Allocator = PoolAllocator<T>>
 class LinkedList {
  public:
   //! Construtor
@@ -13,12 +24,31 @@ class LinkedList {
    */
   LinkedList(void) = default;
 
+  //! Construtor de movimento
+  /*!
+     Cria uma lista tomando para si os nodos de other, sem copiar os dados.
+     other fica vazia.
+
+     \param other: Lista de origem (LinkedList&&).
+   */
+  LinkedList(LinkedList&& other);
+
   //! Destrutor
   /*!
      Destrutor da lista encadeada.
    */
   ~LinkedList(void);
 
+  //! Atribuição por movimento
+  /*!
+     Remove os elementos atuais e toma para si os nodos de other, sem copiar os
+     dados. other fica vazia.
+
+     \param other: Lista de origem (LinkedList&&).
+     \return Referência para esta lista (LinkedList&).
+   */
+  LinkedList& operator=(LinkedList&& other);
+
   //! Método limpa
   /*!
      Limpa a lista.
@@ -28,13 +58,36 @@ class LinkedList {
   //! Método adiciona no fim da lista
   /*!
      Adiciona elemento (data) no fim da lista, se houver espaço. Se não houver
-     espaço, lança exceção (out_of_range).
+     espaço, lança exceção (out_of_range). O fim é acessado pelo ponteiro de
+     cauda, em tempo constante.
 
      \param data: Referência constante para o elemento a ser adicionado na lista
      (const T&).
    */
   void push_back(const T& data);
 
+  //! Método adiciona no fim da lista (movimento)
+  /*!
+     Como push_back(const T&), mas move data para o novo nodo em vez de
+     copiá-lo.
+
+     \param data: Elemento a ser movido para a lista (T&&).
+   */
+  void push_back(T&& data);
+
+  //! Método constrói no fim da lista
+  /*!
+     Constrói o elemento diretamente em um novo nodo no fim da lista,
+     repassando args ao construtor de T, sem cópias nem movimentos.
+
+     \param args: Argumentos repassados ao construtor de T.
+     \return Referência ao elemento adicionado (T&).
+   */
+  template <typename... Args>
+  T& emplace_back(Args&&... args) {
+    return emplace(size_, std::forward<Args>(args)...);
+  }
+
   //! Método adiciona no início da lista
   /*!
      Adiciona elemento (data) no início da lista, se houver espaço. Se não
@@ -45,6 +98,27 @@ class LinkedList {
    */
   void push_front(const T& data);
 
+  //! Método adiciona no início da lista (movimento)
+  /*!
+     Como push_front(const T&), mas move data para o novo nodo em vez de
+     copiá-lo.
+
+     \param data: Elemento a ser movido para a lista (T&&).
+   */
+  void push_front(T&& data);
+
+  //! Método constrói no início da lista
+  /*!
+     Como emplace_back, mas adiciona o elemento no início da lista.
+
+     \param args: Argumentos repassados ao construtor de T.
+     \return Referência ao elemento adicionado (T&).
+   */
+  template <typename... Args>
+  T& emplace_front(Args&&... args) {
+    return emplace(0u, std::forward<Args>(args)...);
+  }
+
   //! Método insere na posição
   /*!
      Insere elemento (data) em uma dada posição da lista (index), se houver
@@ -56,6 +130,81 @@ class LinkedList {
    */
   void insert(const T& data, std::size_t index);
 
+  //! Método insere na posição (movimento)
+  /*!
+     Como insert(const T&, size_t), mas move data para o novo nodo em vez de
+     copiá-lo.
+
+     \param data: Elemento a ser movido para a lista (T&&).
+     \param index: Posição para inserir o elemento (size_t).
+   */
+  void insert(T&& data, std::size_t index);
+
+  //! Método constrói na posição
+  /*!
+     Como emplace_back, mas insere o elemento na posição index. Se a posição
+     não for válida, lança exceção (out_of_range) sem construir o elemento.
+
+     \param index: Posição para inserir o elemento (size_t).
+     \param args: Argumentos repassados ao construtor de T.
+     \return Referência ao elemento inserido (T&).
+   */
+  template <typename... Args>
+  T& emplace(std::size_t index, Args&&... args) {
+    if (index > size_) {
+      throw std::out_of_range("Invalid index");
+    }
+    Node* node = make_node(std::forward<Args>(args)...);
+    insert_node(node, index);
+    return node->data();
+  }
+
+  //! Método anexa intervalo
+  /*!
+     Adiciona ao fim da lista, em ordem, os elementos do intervalo
+     [first, last). Os nodos são construídos antes e encadeados de uma só vez
+     ao fim da lista; se a construção de algum elemento lançar exceção, os
+     nodos já construídos são liberados e a lista não é alterada.
+
+     \param first: Início do intervalo (InputIt).
+     \param last: Fim do intervalo (InputIt).
+   */
+  template <typename InputIt>
+  void append(InputIt first, InputIt last) {
+    Node* chain_head = nullptr;
+    Node* chain_tail = nullptr;
+    std::size_t count = 0u;
+    try {
+      for (; first != last; ++first) {
+        Node* node = make_node(*first);
+        if (chain_head == nullptr) {
+          chain_head = node;
+        } else {
+          chain_tail->next(node);
+        }
+        chain_tail = node;
+        count++;
+      }
+    } catch (...) {
+      delete_nodes(chain_head);
+      throw;
+    }
+    splice_back(chain_head, chain_tail, count);
+  }
+
+  //! Método anexa lista
+  /*!
+     Move todos os nodos de other para o fim da lista, sem alocar nem copiar
+     os dados. other fica vazia. Custa tempo constante quando os alocadores
+     compartilham nodos (como std::allocator) e um passo por bloco do
+     PoolAllocator de other, cujos blocos são absorvidos; com outros
+     alocadores, os elementos são movidos um a um. Se other for a própria
+     lista, lança exceção (invalid_argument).
+
+     \param other: Lista cujos nodos são anexados (LinkedList&&).
+   */
+  void append(LinkedList&& other);
+
   //! Método insere ordenado
   /*!
      Insere elemento (data) em ordem na lista (caso a lista possua ordem). Se
@@ -69,9 +218,10 @@ class LinkedList {
   //! Método remove do final
   /*!
      Remove elemento no final da lista, se houver elementos. Se não houver
-     elementos, lança exceção (out_of_range).
+     elementos, lança exceção (out_of_range). Percorre a lista até o penúltimo
+     nodo, pois os nodos não apontam para o anterior.
 
-     \return Elemento removido (T).
+     \return Elemento removido, movido para fora do nodo (T).
    */
   T pop_back(void);
 
@@ -81,7 +231,7 @@ class LinkedList {
      para frente", se houver elementos. Se não houver elementos, lança exceção
      (out_of_range).
 
-     \return Elemento removido (T)
+     \return Elemento removido, movido para fora do nodo (T).
    */
   T pop_front(void);
 
@@ -92,7 +242,7 @@ class LinkedList {
      exceção (out_of_range).
 
      \param index: Posição do elemento a ser removido (size_t).
-     \return Elemento removido (T)
+     \return Elemento removido, movido para fora do nodo (T).
    */
   T pop(std::size_t index);
 
@@ -149,7 +299,8 @@ class LinkedList {
   //! Método "em"
   /*!
      Retorna referência ao elemento na posição (index). Caso o índice seja
-     inválido lança exceção (out_of_range).
+     inválido lança exceção (out_of_range). O último elemento é acessado em
+     tempo constante.
 
      \param index: Posição do elemento a ser retornado (size_t).
      \return Referência ao elemento na posição (const T&).
@@ -211,6 +362,17 @@ class LinkedList {
      */
     Node(const T& data, Node* next) : data_{data}, next_{next} {}
 
+    //! Construtor no lugar
+    /*!
+       Constrói o dado diretamente no nodo, repassando args ao construtor de T,
+       sem cópias nem movimentos.
+
+       \param args: Argumentos repassados ao construtor de T.
+     */
+    template <typename... Args>
+    explicit Node(std::in_place_t, Args&&... args)
+        : data_(std::forward<Args>(args)...) {}
+
     //! Método dado
     /*!
        Getter do atributo privado data_. Dado armazenado no nodo.
@@ -267,22 +429,79 @@ class LinkedList {
     Node* next_{nullptr};
   };
 
+  //! Alocador de nodos
+  using NodeAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+
+  //! Operações do alocador de nodos
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+  //! Método cria nodo
+  /*!
+     Obtém um nodo do alocador e constrói nele o dado, repassando args ao
+     construtor de T. Se a construção lançar exceção, devolve o nodo ao
+     alocador.
+
+     \param args: Argumentos repassados ao construtor de T.
+     \return Nodo criado, ainda não encadeado (Node *).
+   */
+  template <typename... Args>
+  Node* make_node(Args&&... args) {
+    Node* node = NodeTraits::allocate(allocator_, 1);
+    try {
+      NodeTraits::construct(allocator_, node, std::in_place,
+                            std::forward<Args>(args)...);
+    } catch (...) {
+      NodeTraits::deallocate(allocator_, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  //! Método destrói nodo
+  /*!
+     Destrói o dado do nodo e devolve o nodo ao alocador.
+
+     \param node: Nodo já desencadeado (Node *).
+   */
+  void destroy_node(Node* node);
+
   //! Fim
   /*!
-     Método auxiliar fim. Segue os ponteiros até o último elemento da lista
-     encadeada.
+     Método auxiliar fim. Retorna o último elemento da lista encadeada, mantido
+     em tail_.
 
      \return Referência a Node. Último elemento da lista encadeada (Node *).
    */
-  Node* end(void) {
-    Node * last = head_;
+  Node* end(void) { return tail_; }
 
-    for (auto i = 1u; i < size(); i++) {
-      last = last->next();
-    }
+  //! Método insere nodo
+  /*!
+     Encadeia um nodo já construído na posição index, que deve ser válida.
 
-    return last;
-  }
+     \param node: Nodo a ser inserido (Node *).
+     \param index: Posição do nodo na lista (size_t).
+   */
+  void insert_node(Node* node, std::size_t index);
+
+  //! Método encadeia no fim
+  /*!
+     Encadeia ao fim da lista a cadeia de count nodos de first a last, em
+     tempo constante. Nada faz se count for zero.
+
+     \param first: Primeiro nodo da cadeia (Node *).
+     \param last: Último nodo da cadeia (Node *).
+     \param count: Quantidade de nodos da cadeia (size_t).
+   */
+  void splice_back(Node* first, Node* last, std::size_t count);
+
+  //! Método libera nodos
+  /*!
+     Libera a cadeia de nodos iniciada em first, até o nullptr final.
+
+     \param first: Primeiro nodo da cadeia (Node *).
+   */
+  void delete_nodes(Node* first);
 
   //! Método antes do índice
   /*!
@@ -309,11 +528,24 @@ class LinkedList {
    */
   Node* head_{nullptr};
 
+  //! Cauda de Lista
+  /*!
+     Cauda de lista. Ponteiro para node. Aponta para o último elemento da
+     lista, ou nullptr se a lista estiver vazia. (Node *).
+   */
+  Node* tail_{nullptr};
+
   //! Tamanho
   /*!
      Tamanho da lista. Tipo size_t.
   */
   std::size_t size_{0u};
+
+  //! Alocador
+  /*!
+     Alocador dos nodos da lista.
+   */
+  NodeAllocator allocator_;
 };
 }  // namespace structures
 
@@ -0,0 +1,305 @@
+#ifndef STRUCTURES_POOL_ALLOCATOR_H_
+#define STRUCTURES_POOL_ALLOCATOR_H_
+
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace structures {
+//! Classe PoolAllocator
+/*!
+   Alocador de nodos por blocos. Reserva memória em blocos contíguos de nodos,
+   de tamanho crescente, e guarda os nodos liberados em uma lista livre para
+   reutilizá-los na próxima alocação. Assim, uma estrutura que insere e remove
+   continuamente só chama o alocador global quando cresce além do maior
+   tamanho que já teve.
+
+   Os blocos pertencem a um reservatório (Pool), criado na primeira alocação
+   e devolvido ao sistema quando nenhum alocador o usa mais. Cada instância
+   tem o seu reservatório até absorver outra com merge: a partir daí, as duas
+   alocam do mesmo reservatório e são iguais, e cada uma pode liberar os
+   objetos da outra. O alocador não pode ser copiado. Alocações de mais de um
+   objeto usam o operator new global.
+ */
+template <typename T>
+class PoolAllocator {
+ public:
+  using value_type = T;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  //! Construtor
+  /*!
+     Cria um alocador sem reservatório; ele é criado na primeira alocação.
+   */
+  PoolAllocator(void) = default;
+
+  //! Construtor de movimento
+  /*!
+     Toma para si o reservatório de other, que fica sem reservatório. Os
+     objetos alocados por other passam a ser liberados por este alocador.
+
+     \param other: Alocador de origem (PoolAllocator&&).
+   */
+  PoolAllocator(PoolAllocator&& other) noexcept
+      : pool_{std::move(other.pool_)} {}
+
+  PoolAllocator(const PoolAllocator&) = delete;
+  PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+  //! Atribuição por movimento
+  /*!
+     Deixa o reservatório atual, que é devolvido ao sistema se nenhum outro
+     alocador o usar, e toma para si o reservatório de other.
+
+     \param other: Alocador de origem (PoolAllocator&&).
+     \return Referência para este alocador (PoolAllocator&).
+   */
+  PoolAllocator& operator=(PoolAllocator&& other) noexcept {
+    if (this != &other) {
+      pool_ = std::move(other.pool_);
+    }
+    return *this;
+  }
+
+  //! Método aloca
+  /*!
+     Retorna memória para count objetos, sem construí-los. Um objeto vem da
+     lista livre ou, se ela estiver vazia, do bloco atual; um novo bloco é
+     reservado quando o atual se esgota.
+
+     \param count: Quantidade de objetos (size_t).
+     \return Ponteiro para a memória (T *).
+   */
+  T* allocate(std::size_t count) {
+    if (count != 1) {
+      return static_cast<T*>(::operator new(count * sizeof(T)));
+    }
+    if (pool_ == nullptr) {
+      pool_ = std::make_shared<Pool>();
+    }
+    return reinterpret_cast<T*>(pool().take());
+  }
+
+  //! Método libera
+  /*!
+     Devolve a memória de count objetos, já destruídos, obtida com allocate.
+     Um objeto volta para a lista livre.
+
+     \param pointer: Memória a ser devolvida (T *).
+     \param count: Quantidade de objetos (size_t).
+   */
+  void deallocate(T* pointer, std::size_t count) {
+    if (count != 1) {
+      ::operator delete(pointer);
+      return;
+    }
+    pool().give(reinterpret_cast<Slot*>(pointer));
+  }
+
+  //! Método absorve
+  /*!
+     Passa a alocar do mesmo reservatório que other: os blocos do
+     reservatório de other vão para o deste alocador, e o de other passa a
+     apontar para ele. Os objetos alocados por qualquer um dos dois, ou por
+     alocadores que já compartilhavam o reservatório de other, podem ser
+     liberados por qualquer um deles, o que permite transferir nodos entre
+     estruturas sem copiá-los, mesmo que other continue com nodos. Custa um
+     passo por bloco de other; os espaços livres de other só são
+     reaproveitados se este alocador não tiver nenhum.
+
+     \param other: Alocador a ser absorvido (PoolAllocator&).
+   */
+  void merge(PoolAllocator& other) {
+    if (other.pool_ == nullptr) {
+      return;
+    }
+    if (pool_ == nullptr) {
+      pool_ = other.root();
+      return;
+    }
+    std::shared_ptr<Pool> from = other.root();
+    if (root() == from) {
+      return;
+    }
+    pool_->absorb(*from);
+    from->forward = pool_;
+    other.pool_ = pool_;
+  }
+
+  //! Sobrecarga do operador ==
+  /*!
+     Dois alocadores são iguais se forem a mesma instância ou se alocarem do
+     mesmo reservatório.
+   */
+  bool operator==(const PoolAllocator& other) const {
+    if (this == &other) {
+      return true;
+    }
+    if (pool_ == nullptr || other.pool_ == nullptr) {
+      return false;
+    }
+    const Pool* pool = pool_.get();
+    while (pool->forward != nullptr) {
+      pool = pool->forward.get();
+    }
+    const Pool* other_pool = other.pool_.get();
+    while (other_pool->forward != nullptr) {
+      other_pool = other_pool->forward.get();
+    }
+    return pool == other_pool;
+  }
+
+  //! Sobrecarga do operador !=
+  bool operator!=(const PoolAllocator& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  //! Espaço de um objeto
+  /*!
+     Enquanto livre, guarda o próximo espaço da lista livre.
+   */
+  union Slot {
+    Slot* next;
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  //! Cabeçalho de bloco
+  /*!
+     Encadeia os blocos reservados; os espaços seguem o cabeçalho.
+   */
+  struct Chunk {
+    Chunk* next;
+  };
+
+  //! Espaços no primeiro bloco
+  static constexpr std::size_t FIRST_CHUNK_SIZE = 32u;
+
+  //! Máximo de espaços por bloco
+  static constexpr std::size_t MAX_CHUNK_SIZE = 4096u;
+
+  //! Deslocamento dos espaços a partir do início do bloco
+  static constexpr std::size_t SLOTS_OFFSET =
+      (sizeof(Chunk) + alignof(Slot) - 1) / alignof(Slot) * alignof(Slot);
+
+  //! Reservatório de blocos
+  /*!
+     Dono dos blocos, devolvidos ao sistema quando ele é destruído. Depois
+     de absorvido por outro, fica sem blocos e aponta (forward) para ele.
+   */
+  struct Pool {
+    Pool(void) = default;
+    Pool(const Pool&) = delete;
+    Pool& operator=(const Pool&) = delete;
+
+    ~Pool(void) {
+      while (chunks != nullptr) {
+        ::operator delete(std::exchange(chunks, chunks->next));
+      }
+    }
+
+    //! Retorna um espaço da lista livre ou do bloco atual.
+    Slot* take(void) {
+      if (free != nullptr) {
+        return std::exchange(free, free->next);
+      }
+      if (next == end) {
+        grow();
+      }
+      return next++;
+    }
+
+    //! Devolve um espaço para a lista livre.
+    void give(Slot* slot) {
+      slot->next = free;
+      free = slot;
+    }
+
+    //! Reserva um novo bloco, com o dobro de espaços do anterior até
+    //! MAX_CHUNK_SIZE, e passa a alocar a partir dele.
+    void grow(void) {
+      void* memory = ::operator new(SLOTS_OFFSET + chunk_size * sizeof(Slot));
+      Chunk* chunk = static_cast<Chunk*>(memory);
+      chunk->next = chunks;
+      chunks = chunk;
+      next = reinterpret_cast<Slot*>(static_cast<unsigned char*>(memory) +
+                                     SLOTS_OFFSET);
+      end = next + chunk_size;
+      if (chunk_size < MAX_CHUNK_SIZE) {
+        chunk_size *= 2;
+      }
+    }
+
+    //! Toma para si os blocos de other, que fica sem blocos.
+    void absorb(Pool& other) {
+      if (other.chunks == nullptr) {
+        return;
+      }
+      if (chunks == nullptr) {
+        chunks = std::exchange(other.chunks, nullptr);
+        free = std::exchange(other.free, nullptr);
+        next = std::exchange(other.next, nullptr);
+        end = std::exchange(other.end, nullptr);
+        chunk_size = std::exchange(other.chunk_size, FIRST_CHUNK_SIZE);
+        return;
+      }
+      Chunk* last = other.chunks;
+      while (last->next != nullptr) {
+        last = last->next;
+      }
+      last->next = chunks->next;
+      chunks->next = std::exchange(other.chunks, nullptr);
+      if (free == nullptr) {
+        free = other.free;
+      }
+      other.free = nullptr;
+      other.next = nullptr;
+      other.end = nullptr;
+    }
+
+    //! Blocos reservados, do mais recente ao mais antigo
+    Chunk* chunks{nullptr};
+
+    //! Lista livre
+    Slot* free{nullptr};
+
+    //! Próximo espaço nunca usado do bloco atual
+    Slot* next{nullptr};
+
+    //! Fim do bloco atual
+    Slot* end{nullptr};
+
+    //! Espaços do próximo bloco
+    std::size_t chunk_size{FIRST_CHUNK_SIZE};
+
+    //! Reservatório que absorveu este, ou nulo
+    std::shared_ptr<Pool> forward;
+  };
+
+  //! Método raiz
+  /*!
+     Segue os reservatórios absorvidos até o que guarda os blocos e passa a
+     apontar diretamente para ele.
+
+     \return Reservatório atual (shared_ptr<Pool>&).
+   */
+  std::shared_ptr<Pool>& root(void) {
+    while (pool_->forward != nullptr) {
+      pool_ = pool_->forward;
+    }
+    return pool_;
+  }
+
+  //! Reservatório atual, que deve existir
+  Pool& pool(void) { return *root(); }
+
+  //! Reservatório, ou nulo antes da primeira alocação
+  std::shared_ptr<Pool> pool_;
+};
+}  // namespace structures
+
+#endif
@@ -1,72 +1,132 @@
+#include <memory>
 #include <stdexcept>
+#include <string>
+#include <utility>
+
 #include "linked_list.h"
 
-template <typename T>
-structures::LinkedList<T>::~LinkedList(void) {
+namespace {
+//! Função adota nodos
+/*!
+   Prepara to para liberar os nodos alocados por from. Alocadores iguais
+   compartilham nodos; nos demais casos, retorna falso.
+ */
+template <typename A>
+bool adopt(A& to, A& from) {
+  return to == from;
+}
+
+//! Função adota nodos
+/*!
+   Um PoolAllocator absorve os blocos de from e passa a liberar seus nodos.
+ */
+template <typename N>
+bool adopt(structures::PoolAllocator<N>& to,
+           structures::PoolAllocator<N>& from) {
+  to.merge(from);
+  return true;
+}
+}  // namespace
+
+template <typename T, typename Allocator>
+structures::LinkedList<T, Allocator>::LinkedList(LinkedList&& other)
+    : allocator_{std::move(other.allocator_)} {
+  head_ = other.head_;
+  tail_ = other.tail_;
+  size_ = other.size_;
+  other.head_ = nullptr;
+  other.tail_ = nullptr;
+  other.size_ = 0u;
+}
+
+template <typename T, typename Allocator>
+structures::LinkedList<T, Allocator>::~LinkedList(void) {
   clear();
 }
 
-template <typename T>
-void structures::LinkedList<T>::clear(void) {
+template <typename T, typename Allocator>
+structures::LinkedList<T, Allocator>&
+structures::LinkedList<T, Allocator>::operator=(LinkedList&& other) {
+  if (this != &other) {
+    clear();
+    allocator_ = std::move(other.allocator_);
+    head_ = other.head_;
+    tail_ = other.tail_;
+    size_ = other.size_;
+    other.head_ = nullptr;
+    other.tail_ = nullptr;
+    other.size_ = 0u;
+  }
+  return *this;
+}
+
+template <typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::clear(void) {
   while (!empty()) {
     pop_front();
   }
 }
 
-template <typename T>
-std::size_t structures::LinkedList<T>::size(void) const {
+template <typename T, typename Allocator>
+std::size_t structures::LinkedList<T, Allocator>::size(void) const {
   return size_;
 }
 
-template <typename T>
-bool structures::LinkedList<T>::empty(void) const {
+template <typename T, typename Allocator>
+bool structures::LinkedList<T, Allocator>::empty(void) const {
   return size_ == 0;
 }
 
-template <typename T>
-void structures::LinkedList<T>::push_back(const T& data) {
-  insert(data, size_);
+template <typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::push_back(const T& data) {
+  emplace_back(data);
 }
 
-template <typename T>
-void structures::LinkedList<T>::push_front(const T& data) {
-  Node* new_node = new Node(data);
-
-  if (new_node == nullptr) {
-    throw std::out_of_range("Full list");
-  }
-
-  new_node->next(head_);
-  head_ = new_node;
-  size_++;
+template <typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::push_back(T&& data) {
+  emplace_back(std::move(data));
 }
 
-template <typename T>
-void structures::LinkedList<T>::insert(const T& data, std::size_t index) {
-  if (index > size_) {
-    throw std::out_of_range("Invalid index");
-  }
+template <typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::push_front(const T& data) {
+  emplace_front(data);
+}
 
-  if (index == 0) {
-    push_front(data);
-  } else {
-    Node* new_node = new Node(data);
-    if (new_node == nullptr) {
-      throw std::out_of_range("Full list");
-    }
+template <typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::push_front(T&& data) {
+  emplace_front(std::move(data));
+}
 
-    Node* before = before_index(index);
-    Node* next = before->next();
+template <typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::insert(const T& data,
+                                                  std::size_t index) {
+  emplace(index, data);
+}
 
-    new_node->next(next);
-    before->next(new_node);
+template <typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::insert(T&& data, std::size_t index) {
+  emplace(index, std::move(data));
+}
 
-    size_++;
+template <typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::append(LinkedList&& other) {
+  if (this == &other) {
+    throw std::invalid_argument("Cannot append a list to itself");
   }
+  if (!adopt(allocator_, other.allocator_)) {
+    while (!other.empty()) {
+      push_back(other.pop_front());
+    }
+    return;
+  }
+  splice_back(other.head_, other.tail_, other.size_);
+  other.head_ = nullptr;
+  other.tail_ = nullptr;
+  other.size_ = 0u;
 }
 
-template <typename T>
-void structures::LinkedList<T>::insert_sorted(const T& data) {
+template <typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::insert_sorted(const T& data) {
   if (empty()) {
     push_front(data);
   } else {
@@ -85,29 +145,32 @@ void structures::LinkedList<T>::insert_sorted(const T& data) {
   }
 }
 
-template <typename T>
-T structures::LinkedList<T>::pop_back(void) {
+template <typename T, typename Allocator>
+T structures::LinkedList<T, Allocator>::pop_back(void) {
   return pop(size_ - 1u);
 }
 
-template <typename T>
-T structures::LinkedList<T>::pop_front(void) {
+template <typename T, typename Allocator>
+T structures::LinkedList<T, Allocator>::pop_front(void) {
   if (empty()) {
     throw std::out_of_range("Cannot pop_front from empty list");
   }
 
   Node* out = head_;
-  T data = out->data();
+  T data = std::move(out->data());
 
   head_ = head_->next();
+  if (head_ == nullptr) {
+    tail_ = nullptr;
+  }
   size_--;
-  delete out;
+  destroy_node(out);
 
   return data;
 }
 
-template <typename T>
-T structures::LinkedList<T>::pop(std::size_t index) {
+template <typename T, typename Allocator>
+T structures::LinkedList<T, Allocator>::pop(std::size_t index) {
   if (empty()) {
     throw std::out_of_range("Empty list");
   }
@@ -121,27 +184,30 @@ T structures::LinkedList<T>::pop(std::size_t index) {
 
   Node* before_out = before_index(index);
   Node* out = before_out->next();
-  T data = out->data();
+  T data = std::move(out->data());
 
   before_out->next(out->next());
+  if (out == tail_) {
+    tail_ = before_out;
+  }
   size_--;
-  delete out;
+  destroy_node(out);
 
   return data;
 }
 
-template <typename T>
-void structures::LinkedList<T>::remove(const T& data) {
+template <typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::remove(const T& data) {
   pop(find(data));
 }
 
-template <typename T>
-bool structures::LinkedList<T>::contains(const T& data) const {
+template <typename T, typename Allocator>
+bool structures::LinkedList<T, Allocator>::contains(const T& data) const {
   return find(data) != size();
 }
 
-template <typename T>
-std::size_t structures::LinkedList<T>::find(const T& data) const {
+template <typename T, typename Allocator>
+std::size_t structures::LinkedList<T, Allocator>::find(const T& data) const {
   if (empty()) {
     throw std::out_of_range("Empty List");
   }
@@ -157,17 +223,19 @@ std::size_t structures::LinkedList<T>::find(const T& data) const {
   return index;
 }
 
-template <typename T>
-T& structures::LinkedList<T>::at(std::size_t index) {
+template <typename T, typename Allocator>
+T& structures::LinkedList<T, Allocator>::at(std::size_t index) {
   return const_cast<T&>(static_cast<const LinkedList*>(this)->at(index));
 }
 
-template <typename T>
-const T& structures::LinkedList<T>::at(std::size_t index) const {
+template <typename T, typename Allocator>
+const T& structures::LinkedList<T, Allocator>::at(std::size_t index) const {
   if (empty()) {
     throw std::out_of_range("List is empty");
   } else if (index >= size_) {
     throw std::out_of_range("Index out of bounds");
+  } else if (index == size_ - 1) {
+    return tail_->data();
   }
 
   Node* current = head_;
@@ -179,14 +247,67 @@ const T& structures::LinkedList<T>::at(std::size_t index) const {
   return current->data();
 }
 
-template <typename T>
-T& structures::LinkedList<T>::operator[](std::size_t index) {
+template <typename T, typename Allocator>
+T& structures::LinkedList<T, Allocator>::operator[](std::size_t index) {
   return at(index);
 }
 
-template <typename T>
-const T& structures::LinkedList<T>::operator[](std::size_t index) const {
+template <typename T, typename Allocator>
+const T& structures::LinkedList<T, Allocator>::operator[](
+    std::size_t index) const {
   return const_cast<T&>(static_cast<const LinkedList*>(this)->at(index));
 }
 
+template <typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::insert_node(Node* node,
+                                                       std::size_t index) {
+  if (index == 0) {
+    node->next(head_);
+    head_ = node;
+    if (tail_ == nullptr) {
+      tail_ = node;
+    }
+  } else if (index == size_) {
+    end()->next(node);
+    tail_ = node;
+  } else {
+    Node* before = before_index(index);
+    node->next(before->next());
+    before->next(node);
+  }
+  size_++;
+}
+
+template <typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::splice_back(Node* first, Node* last,
+                                            std::size_t count) {
+  if (count == 0) {
+    return;
+  }
+  if (empty()) {
+    head_ = first;
+  } else {
+    end()->next(first);
+  }
+  tail_ = last;
+  size_ += count;
+}
+
+template <typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::delete_nodes(Node* first) {
+  while (first != nullptr) {
+    Node* next = first->next();
+    destroy_node(first);
+    first = next;
+  }
+}
+
+template <typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::destroy_node(Node* node) {
+  NodeTraits::destroy(allocator_, node);
+  NodeTraits::deallocate(allocator_, node, 1);
+}
+
 template class structures::LinkedList<int>;
+template class structures::LinkedList<int, std::allocator<int>>;
+template class structures::LinkedList<std::string>;
@@ -1,5 +1,11 @@
 #include <stdlib.h>
 
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "gtest/gtest.h"
 #include "linked_list.h"
 
@@ -280,3 +286,181 @@ TEST_F(LinkedListTest, OperatorOverloaded) {
   ASSERT_EQ(list[5], 5);
   ASSERT_EQ(list[9], 9);
 }
+
+TEST_F(LinkedListTest, MoveConstructorTakesNodes) {
+  for (auto i = 0; i < 10; i++) {
+    list.push_back(i);
+  }
+  structures::LinkedList<int> moved{std::move(list)};
+  ASSERT_EQ(10u, moved.size());
+  ASSERT_EQ(0, moved.at(0));
+  ASSERT_EQ(9, moved.at(9));
+  ASSERT_TRUE(list.empty());
+  list.push_back(1);
+  ASSERT_EQ(1, list.at(0));
+}
+
+TEST_F(LinkedListTest, MoveAssignmentReplacesNodes) {
+  structures::LinkedList<int> other{};
+  other.push_back(1);
+  other.push_back(2);
+  list.push_back(-1);
+  list = std::move(other);
+  ASSERT_EQ(2u, list.size());
+  ASSERT_EQ(1, list.at(0));
+  ASSERT_EQ(2, list.at(1));
+  ASSERT_TRUE(other.empty());
+}
+
+TEST_F(LinkedListTest, PushRvalueMovesStrings) {
+  structures::LinkedList<std::string> strings{};
+  std::string back(64, 'b');
+  std::string front(64, 'f');
+  strings.push_back(std::move(back));
+  strings.push_front(std::move(front));
+  strings.insert(std::string(64, 'i'), 1);
+  ASSERT_TRUE(back.empty());
+  ASSERT_TRUE(front.empty());
+  ASSERT_EQ(std::string(64, 'f'), strings.at(0));
+  ASSERT_EQ(std::string(64, 'i'), strings.at(1));
+  ASSERT_EQ(std::string(64, 'b'), strings.at(2));
+}
+
+TEST_F(LinkedListTest, EmplaceConstructsInNodes) {
+  structures::LinkedList<std::string> strings{};
+  ASSERT_EQ("bbb", strings.emplace_back(3u, 'b'));
+  ASSERT_EQ("a", strings.emplace_front("a"));
+  strings.emplace(1, 2u, 'x') += "y";
+  ASSERT_EQ(3u, strings.size());
+  ASSERT_EQ("a", strings.at(0));
+  ASSERT_EQ("xxy", strings.at(1));
+  ASSERT_EQ("bbb", strings.at(2));
+  ASSERT_THROW(strings.emplace(4, "z"), std::out_of_range);
+  ASSERT_EQ(3u, strings.size());
+}
+
+TEST_F(LinkedListTest, PopMovesDataOut) {
+  structures::LinkedList<std::string> strings{};
+  strings.push_back(std::string(64, 'a'));
+  strings.push_back(std::string(64, 'b'));
+  strings.push_back(std::string(64, 'c'));
+  ASSERT_EQ(std::string(64, 'b'), strings.pop(1));
+  ASSERT_EQ(std::string(64, 'c'), strings.pop_back());
+  ASSERT_EQ(std::string(64, 'a'), strings.pop_front());
+  ASSERT_TRUE(strings.empty());
+}
+
+TEST_F(LinkedListTest, PushBackAfterPopsLinksToLastNode) {
+  list.push_back(0);
+  list.pop_front();
+  list.push_back(1);
+  list.push_back(2);
+  list.push_back(3);
+  ASSERT_EQ(3, list.pop_back());
+  list.push_back(4);
+  ASSERT_EQ(4, list.pop(2));
+  list.push_back(5);
+  ASSERT_EQ(3u, list.size());
+  ASSERT_EQ(1, list[0]);
+  ASSERT_EQ(2, list[1]);
+  ASSERT_EQ(5, list[2]);
+}
+
+TEST_F(LinkedListTest, AppendRangeAddsToTheEnd) {
+  std::vector<int> values{1, 2, 3};
+  list.push_back(0);
+  list.append(values.begin(), values.end());
+  list.append(values.end(), values.end());
+  list.push_back(4);
+  ASSERT_EQ(5u, list.size());
+  for (auto i = 0; i < 5; i++) {
+    ASSERT_EQ(i, list.at(i));
+  }
+}
+
+namespace {
+// Iterador de entrada que lança exceção ao ser lido na posição fail.
+struct ThrowingIterator {
+  int position;
+  int fail;
+
+  int operator*() const {
+    if (position == fail) {
+      throw std::runtime_error("read failed");
+    }
+    return position;
+  }
+  ThrowingIterator& operator++() {
+    position++;
+    return *this;
+  }
+  bool operator!=(const ThrowingIterator& other) const {
+    return position != other.position;
+  }
+};
+}  // namespace
+
+TEST_F(LinkedListTest, AppendRangeLeavesListUnchangedOnError) {
+  list.push_back(-1);
+  ASSERT_THROW(list.append(ThrowingIterator{0, 3}, ThrowingIterator{5, 3}),
+               std::runtime_error);
+  ASSERT_EQ(1u, list.size());
+  list.push_back(-2);
+  ASSERT_EQ(-2, list.at(1));
+}
+
+TEST_F(LinkedListTest, AppendListSplicesNodes) {
+  structures::LinkedList<int> other{};
+  other.push_back(1);
+  other.push_back(2);
+  list.push_back(0);
+  list.append(std::move(other));
+  ASSERT_TRUE(other.empty());
+  list.push_back(3);
+  ASSERT_EQ(4u, list.size());
+  for (auto i = 0; i < 4; i++) {
+    ASSERT_EQ(i, list.at(i));
+  }
+  other.append(std::move(list));
+  ASSERT_EQ(4u, other.size());
+  ASSERT_EQ(3, other.at(3));
+  ASSERT_THROW(other.append(std::move(other)), std::invalid_argument);
+}
+
+TEST_F(LinkedListTest, PoolReusesRemovedNodes) {
+  list.push_back(1);
+  const int* first = &list.at(0);
+  list.pop_front();
+  list.push_back(2);
+  ASSERT_EQ(first, &list.at(0));
+}
+
+TEST_F(LinkedListTest, AppendKeepsNodesOfDestroyedList) {
+  {
+    structures::LinkedList<int> other{};
+    for (auto i = 1; i < 100; i++) {
+      other.push_back(i);
+    }
+    other.pop_front();
+    list.push_back(0);
+    list.append(std::move(other));
+  }
+  list.push_back(100);
+  ASSERT_EQ(100u, list.size());
+  ASSERT_EQ(2, list.at(1));
+  ASSERT_EQ(100, list.at(99));
+}
+
+TEST_F(LinkedListTest, WorksWithStandardAllocator) {
+  structures::LinkedList<int, std::allocator<int>> standard{};
+  structures::LinkedList<int, std::allocator<int>> other{};
+  standard.push_back(1);
+  standard.push_front(0);
+  other.push_back(2);
+  standard.append(std::move(other));
+  ASSERT_TRUE(other.empty());
+  ASSERT_EQ(3u, standard.size());
+  for (auto i = 0; i < 3; i++) {
+    ASSERT_EQ(i, standard.pop_front());
+  }
+}
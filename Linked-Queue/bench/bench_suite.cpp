@@ -0,0 +1,21 @@
+#include "benchmark.h"
+#include "linked_queue.h"
+
+// Suíte de desempenho da LinkedQueue (ver benchmark::Suite). Para cada
+// tamanho: insert (enqueue), lookup (front) e remove (dequeue).
+
+int main(int argc, char* argv[]) {
+  benchmark::Suite suite{argc, argv};
+  for (auto size : suite.sizes()) {
+    structures::LinkedQueue<int> queue;
+    suite.measure("LinkedQueue", "insert", size, size,
+                  [&](std::size_t i) { queue.enqueue(static_cast<int>(i)); });
+
+    suite.measure("LinkedQueue", "lookup", size, size,
+                  [&](std::size_t) { benchmark::keep(queue.front()); });
+
+    suite.measure("LinkedQueue", "remove", size, size,
+                  [&](std::size_t) { benchmark::keep(queue.dequeue()); });
+  }
+  return 0;
+}
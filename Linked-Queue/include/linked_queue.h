@@ -2,6 +2,7 @@
 #define STRUCTURES_LINKED_QUEUE_H_
 
 #include <cstdint>
+#include <utility>
 
 namespace structures {
 template <typename T>
@@ -13,12 +14,31 @@ class LinkedQueue {
   */
   LinkedQueue(void);
 
+  //! Construtor de movimento
+  /*!
+     Cria uma fila tomando para si os nodos de other, sem copiar os dados.
+     other fica vazia.
+
+     \param other: Fila de origem (LinkedQueue&&).
+  */
+  LinkedQueue(LinkedQueue&& other);
+
   //! Destrutor
   /*!
      Destrói objeto quando esse sai de contexto.
   */
   ~LinkedQueue(void);
 
+  //! Atribuição por movimento
+  /*!
+     Remove os elementos atuais e toma para si os nodos de other, sem copiar os
+     dados. other fica vazia.
+
+     \param other: Fila de origem (LinkedQueue&&).
+     \return Referência para esta fila (LinkedQueue&).
+  */
+  LinkedQueue& operator=(LinkedQueue&& other);
+
   //! Limpa Pilha
   /*!
      Método Limpa Pilha. Remove todos os elementos da pilha.
@@ -34,12 +54,37 @@ class LinkedQueue {
   */
   void enqueue(const T& data);
 
+  //! Enfileira (movimento)
+  /*!
+     Como enqueue(const T&), mas move o dado para o novo nodo em vez de
+     copiá-lo.
+
+     \param data: Dado a ser movido para a fila (T&&).
+  */
+  void enqueue(T&& data);
+
+  //! Constrói no Fim
+  /*!
+     Método Constrói no Fim. Constrói o dado diretamente em um novo nodo no fim
+     da fila, repassando args ao construtor de T, sem cópias nem movimentos.
+
+     \param args: Argumentos repassados ao construtor de T.
+     \return Referência ao dado enfileirado (T&).
+  */
+  template <typename... Args>
+  T& emplace(Args&&... args) {
+    Node* node = new Node(std::in_place, std::forward<Args>(args)...);
+    enqueue_node(node);
+    return node->data();
+  }
+
   //! Desenfileira
   /*!
      Método Desenfileira Dado. Desenfileira o nodo no início da fila e retorna o
      dado de tipo genérico (T) que contém.
 
-     \return Dado contido no nodo que foi desenfileirado, de tipo genérico (T).
+     \return Dado contido no nodo que foi desenfileirado, de tipo genérico (T),
+     movido para fora do nodo.
    */
   T dequeue(void);
 
@@ -128,6 +173,17 @@ class LinkedQueue {
      */
     Node(const T& data, Node* next) : data_{data}, next_{next} {}
 
+    //! Construtor no lugar
+    /*!
+       Constrói o dado diretamente no nodo, repassando args ao construtor de T,
+       sem cópias nem movimentos.
+
+       \param args: Argumentos repassados ao construtor de T.
+     */
+    template <typename... Args>
+    explicit Node(std::in_place_t, Args&&... args)
+        : data_(std::forward<Args>(args)...) {}
+
     //! Método dado
     /*!
        Getter do atributo privado data_. Dado armazenado no nodo.
@@ -184,6 +240,15 @@ class LinkedQueue {
     Node* next_{nullptr};
   };
 
+  //! Enfileira Nodo
+  /*!
+     Método privado Enfileira Nodo. Coloca um nodo já construído no fim da
+     fila.
+
+     \param node: Nodo a ser enfileirado (Node*).
+   */
+  void enqueue_node(Node* node);
+
   //! Início da Fila
   /*!
      Ponteiro para nodo. Aponta para o nodo no início da fila.
@@ -1,6 +1,8 @@
 #include "linked_queue.h"
 
 #include <stdexcept>
+#include <string>
+#include <utility>
 
 template<typename T>
 structures::LinkedQueue<T>::LinkedQueue(void) {
@@ -9,11 +11,36 @@ structures::LinkedQueue<T>::LinkedQueue(void) {
   size_ = 0u;
 }
 
+template<typename T>
+structures::LinkedQueue<T>::LinkedQueue(LinkedQueue&& other) {
+  head_ = other.head_;
+  tail_ = other.tail_;
+  size_ = other.size_;
+  other.head_ = nullptr;
+  other.tail_ = nullptr;
+  other.size_ = 0u;
+}
+
 template<typename T>
 structures::LinkedQueue<T>::~LinkedQueue(void) {
   clear();
 }
 
+template<typename T>
+structures::LinkedQueue<T>& structures::LinkedQueue<T>::operator=(
+    LinkedQueue&& other) {
+  if (this != &other) {
+    clear();
+    head_ = other.head_;
+    tail_ = other.tail_;
+    size_ = other.size_;
+    other.head_ = nullptr;
+    other.tail_ = nullptr;
+    other.size_ = 0u;
+  }
+  return *this;
+}
+
 template<typename T>
 void structures::LinkedQueue<T>::clear(void) {
   while(!empty()) {
@@ -23,20 +50,12 @@ void structures::LinkedQueue<T>::clear(void) {
 
 template<typename T>
 void structures::LinkedQueue<T>::enqueue(const T& data) {
-  Node* new_node = new Node(data);
-  if (new_node == nullptr) {
-    throw std::out_of_range("Full queue");
-  }
-
-  if (empty()) {
-    head_ = new_node;
-  } else {
-    tail_->next(new_node);
-  }
+  emplace(data);
+}
 
-  new_node->next(nullptr);
-  tail_ = new_node;
-  size_++;
+template<typename T>
+void structures::LinkedQueue<T>::enqueue(T&& data) {
+  emplace(std::move(data));
 }
 
 template<typename T>
@@ -46,7 +65,7 @@ T structures::LinkedQueue<T>::dequeue(void) {
   }
 
   Node* out = head_;
-  T data = out->data();
+  T data = std::move(out->data());
   head_ = head_->next();
 
   if (size() == 1) {
@@ -97,4 +116,18 @@ std::size_t structures::LinkedQueue<T>::size(void) const {
   return size_;
 }
 
+template<typename T>
+void structures::LinkedQueue<T>::enqueue_node(Node* node) {
+  if (empty()) {
+    head_ = node;
+  } else {
+    tail_->next(node);
+  }
+
+  node->next(nullptr);
+  tail_ = node;
+  size_++;
+}
+
 template class structures::LinkedQueue<int>;
+template class structures::LinkedQueue<std::string>;
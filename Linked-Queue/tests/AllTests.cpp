@@ -1,4 +1,6 @@
 #include <stdexcept>
+#include <string>
+#include <utility>
 
 #include "linked_queue.h"
 #include "gtest/gtest.h"
@@ -93,3 +95,26 @@ TEST_F(LinkedQueueTest, DequeueReturnsCorrectElement) {
     ASSERT_EQ(i, queue.dequeue());
   }
 }
+
+TEST_F(LinkedQueueTest, MoveAssignmentTakesNodes) {
+  fill();
+  structures::LinkedQueue<int> moved{};
+  moved.enqueue(-1);
+  moved = std::move(queue);
+  ASSERT_EQ(10u, moved.size());
+  ASSERT_EQ(0, moved.front());
+  ASSERT_EQ(9, moved.back());
+  ASSERT_TRUE(queue.empty());
+  queue.enqueue(1);
+  ASSERT_EQ(1, queue.back());
+}
+
+TEST_F(LinkedQueueTest, EnqueueRvalueAndEmplaceMoveStrings) {
+  structures::LinkedQueue<std::string> strings{};
+  std::string enqueued(64, 'q');
+  strings.enqueue(std::move(enqueued));
+  ASSERT_TRUE(enqueued.empty());
+  ASSERT_EQ("eee", strings.emplace(3u, 'e'));
+  ASSERT_EQ(std::string(64, 'q'), strings.dequeue());
+  ASSERT_EQ("eee", strings.dequeue());
+}
@@ -0,0 +1,21 @@
+#include "benchmark.h"
+#include "linked_stack.h"
+
+// Suíte de desempenho da LinkedStack (ver benchmark::Suite). Para cada tamanho:
+// insert (push), lookup (top) e remove (pop).
+
+int main(int argc, char* argv[]) {
+  benchmark::Suite suite{argc, argv};
+  for (auto size : suite.sizes()) {
+    structures::LinkedStack<int> stack;
+    suite.measure("LinkedStack", "insert", size, size,
+                  [&](std::size_t i) { stack.push(static_cast<int>(i)); });
+
+    suite.measure("LinkedStack", "lookup", size, size,
+                  [&](std::size_t) { benchmark::keep(stack.top()); });
+
+    suite.measure("LinkedStack", "remove", size, size,
+                  [&](std::size_t) { benchmark::keep(stack.pop()); });
+  }
+  return 0;
+}
@@ -2,6 +2,7 @@
 #define STRUCTURES_LINKED_STACK_H_
 
 #include <cstdint>
+#include <utility>
 
 namespace structures {
 template <typename T>
@@ -13,12 +14,31 @@ class LinkedStack {
   */
   LinkedStack(void);
 
+  //! Construtor de movimento
+  /*!
+     Cria uma pilha tomando para si os nodos de other, sem copiar os dados.
+     other fica vazia.
+
+     \param other: Pilha de origem (LinkedStack&&).
+  */
+  LinkedStack(LinkedStack&& other);
+
   //! Destrutor
   /*!
      Destrói objeto quando esse sai de contexto.
   */
   ~LinkedStack(void);
 
+  //! Atribuição por movimento
+  /*!
+     Remove os elementos atuais e toma para si os nodos de other, sem copiar os
+     dados. other fica vazia.
+
+     \param other: Pilha de origem (LinkedStack&&).
+     \return Referência para esta pilha (LinkedStack&).
+  */
+  LinkedStack& operator=(LinkedStack&& other);
+
   //! Limpa Pilha
   /*!
      Método Limpa Pilha. Remove todos os elementos da pilha.
@@ -34,12 +54,37 @@ class LinkedStack {
   */
   void push(const T& data);
 
+  //! Empilha Dado (movimento)
+  /*!
+     Como push(const T&), mas move o dado para o novo nodo em vez de copiá-lo.
+
+     \param data: Dado a ser movido para a pilha (T&&).
+  */
+  void push(T&& data);
+
+  //! Constrói no Topo
+  /*!
+     Método Constrói no Topo. Constrói o dado diretamente em um novo nodo no
+     topo da pilha, repassando args ao construtor de T, sem cópias nem
+     movimentos.
+
+     \param args: Argumentos repassados ao construtor de T.
+     \return Referência ao dado empilhado (T&).
+  */
+  template <typename... Args>
+  T& emplace(Args&&... args) {
+    Node* node = new Node(std::in_place, std::forward<Args>(args)...);
+    push_node(node);
+    return node->data();
+  }
+
   //! Desempilha Dado
   /*!
      Método Desempilha Dado. Desempilha o nodo no topo da pilha e retorna o dado
      de tipo genérico (T) que contém.
 
-     \return Dado contido no nodo que foi desempilhado, de tipo genérico (T).
+     \return Dado contido no nodo que foi desempilhado, de tipo genérico (T),
+     movido para fora do nodo.
    */
   T pop(void);
 
@@ -107,6 +152,17 @@ class LinkedStack {
      */
     Node(const T& data, Node* next) : data_{data}, next_{next} {}
 
+    //! Construtor no lugar
+    /*!
+       Constrói o dado diretamente no nodo, repassando args ao construtor de T,
+       sem cópias nem movimentos.
+
+       \param args: Argumentos repassados ao construtor de T.
+     */
+    template <typename... Args>
+    explicit Node(std::in_place_t, Args&&... args)
+        : data_(std::forward<Args>(args)...) {}
+
     //! Método dado
     /*!
        Getter do atributo privado data_. Dado armazenado no nodo.
@@ -163,6 +219,15 @@ class LinkedStack {
     Node* next_{nullptr};
   };
 
+  //! Empilha Nodo
+  /*!
+     Método privado Empilha Nodo. Coloca um nodo já construído no topo da
+     pilha.
+
+     \param node: Nodo a ser empilhado (Node*).
+   */
+  void push_node(Node* node);
+
   //! Topo da Pilha
   /*!
      Ponteiro para nodo. Aponta para o nodo no topo da pilha.
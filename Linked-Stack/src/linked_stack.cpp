@@ -1,6 +1,8 @@
 #include "linked_stack.h"
 
 #include <stdexcept>
+#include <string>
+#include <utility>
 
 template<typename T>
 structures::LinkedStack<T>::LinkedStack(void) {
@@ -8,11 +10,32 @@ structures::LinkedStack<T>::LinkedStack(void) {
   size_ = 0u;
 }
 
+template <typename T>
+structures::LinkedStack<T>::LinkedStack(LinkedStack&& other) {
+  top_ = other.top_;
+  size_ = other.size_;
+  other.top_ = nullptr;
+  other.size_ = 0u;
+}
+
 template <typename T>
 structures::LinkedStack<T>::~LinkedStack(void) {
   clear();
 }
 
+template <typename T>
+structures::LinkedStack<T>& structures::LinkedStack<T>::operator=(
+    LinkedStack&& other) {
+  if (this != &other) {
+    clear();
+    top_ = other.top_;
+    size_ = other.size_;
+    other.top_ = nullptr;
+    other.size_ = 0u;
+  }
+  return *this;
+}
+
 template <typename T>
 void structures::LinkedStack<T>::clear(void) {
   while (!empty()) {
@@ -22,14 +45,12 @@ void structures::LinkedStack<T>::clear(void) {
 
 template <typename T>
 void structures::LinkedStack<T>::push(const T& data) {
-  Node* new_node = new Node(data);
-  if (new_node == nullptr) {
-    throw std::out_of_range("Full stack");
-  }
+  emplace(data);
+}
 
-  new_node->next(top_);
-  top_ = new_node;
-  size_++;
+template <typename T>
+void structures::LinkedStack<T>::push(T&& data) {
+  emplace(std::move(data));
 }
 
 template <typename T>
@@ -39,7 +60,7 @@ T structures::LinkedStack<T>::pop(void) {
   }
 
   Node* out = top_;
-  T data = out->data();
+  T data = std::move(out->data());
 
   top_ = top_->next();
   size_--;
@@ -72,4 +93,12 @@ std::size_t structures::LinkedStack<T>::size(void) const {
   return size_;
 }
 
+template <typename T>
+void structures::LinkedStack<T>::push_node(Node* node) {
+  node->next(top_);
+  top_ = node;
+  size_++;
+}
+
 template class structures::LinkedStack<int>;
+template class structures::LinkedStack<std::string>;
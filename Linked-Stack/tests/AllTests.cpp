@@ -1,6 +1,9 @@
 
 #include <stdlib.h>
 
+#include <string>
+#include <utility>
+
 #include "gtest/gtest.h"
 #include "linked_stack.h"
 
@@ -95,3 +98,23 @@ TEST_F(LinkedStackTest, TopAsLhsWorks) {
   stack.top() = -2;
   ASSERT_EQ(-2, stack.top());
 }
+
+TEST_F(LinkedStackTest, MoveConstructorTakesNodes) {
+  fill();
+  structures::LinkedStack<int> moved{std::move(stack)};
+  ASSERT_EQ(10u, moved.size());
+  ASSERT_EQ(9, moved.top());
+  ASSERT_TRUE(stack.empty());
+  stack.push(1);
+  ASSERT_EQ(1, stack.top());
+}
+
+TEST_F(LinkedStackTest, PushRvalueAndEmplaceMoveStrings) {
+  structures::LinkedStack<std::string> strings{};
+  std::string pushed(64, 'p');
+  strings.push(std::move(pushed));
+  ASSERT_TRUE(pushed.empty());
+  ASSERT_EQ("eee", strings.emplace(3u, 'e'));
+  ASSERT_EQ("eee", strings.pop());
+  ASSERT_EQ(std::string(64, 'p'), strings.pop());
+}
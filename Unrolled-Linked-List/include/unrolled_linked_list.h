@@ -0,0 +1,496 @@
+#ifndef STRUCTURES_UNROLLED_LINKED_LIST_H
+#define STRUCTURES_UNROLLED_LINKED_LIST_H
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace structures {
+//! Classe UnrolledLinkedList
+/*!
+   Lista encadeada desenrolada: cada nodo guarda um bloco contíguo de até
+   BLOCK_CAPACITY elementos, em vez de um só. Buscas e percursos leem os
+   elementos de um bloco em sequência na memória, e inserir ou remover no
+   meio desloca apenas os elementos de um bloco. Um bloco cheio é dividido ao
+   meio; um bloco que fica com menos da metade da capacidade é fundido com o
+   seguinte quando os dois cabem em um só.
+ */
+template <typename T>
+class UnrolledLinkedList {
+ public:
+  //! Capacidade de um bloco
+  /*!
+     Quantidade de elementos que ocupa cerca de 512 bytes (oito linhas de
+     cache), com no mínimo 8 elementos por bloco.
+   */
+  static constexpr std::size_t BLOCK_CAPACITY =
+      std::max<std::size_t>(512u / sizeof(T), 8u);
+
+  //! Construtor
+  /*!
+     Construtor da classe lista encadeada desenrolada. Não aloca memória.
+   */
+  UnrolledLinkedList(void) = default;
+
+  //! Construtor de movimento
+  /*!
+     Cria uma lista tomando para si os blocos de other, sem copiar os dados.
+     other fica vazia.
+
+     \param other: Lista de origem (UnrolledLinkedList&&).
+   */
+  UnrolledLinkedList(UnrolledLinkedList&& other);
+
+  //! Destrutor
+  /*!
+     Destrutor da lista encadeada desenrolada.
+   */
+  ~UnrolledLinkedList(void);
+
+  //! Atribuição por movimento
+  /*!
+     Remove os elementos atuais e toma para si os blocos de other, sem copiar
+     os dados. other fica vazia.
+
+     \param other: Lista de origem (UnrolledLinkedList&&).
+     \return Referência para esta lista (UnrolledLinkedList&).
+   */
+  UnrolledLinkedList& operator=(UnrolledLinkedList&& other);
+
+  //! Método limpa
+  /*!
+     Limpa a lista, liberando todos os blocos.
+   */
+  void clear(void);
+
+  //! Método adiciona no fim da lista
+  /*!
+     Adiciona elemento (data) no fim da lista. Custa tempo constante: o
+     elemento vai para o último bloco, ou para um novo bloco se ele estiver
+     cheio.
+
+     \param data: Referência constante para o elemento a ser adicionado na lista
+     (const T&).
+   */
+  void push_back(const T& data);
+
+  //! Método adiciona no fim da lista (movimento)
+  /*!
+     Como push_back(const T&), mas move data para a lista em vez de copiá-lo.
+
+     \param data: Elemento a ser movido para a lista (T&&).
+   */
+  void push_back(T&& data);
+
+  //! Método constrói no fim da lista
+  /*!
+     Constrói o elemento diretamente no último bloco, repassando args ao
+     construtor de T, sem cópias nem movimentos.
+
+     \param args: Argumentos repassados ao construtor de T.
+     \return Referência ao elemento adicionado (T&).
+   */
+  template <typename... Args>
+  T& emplace_back(Args&&... args) {
+    return emplace(size_, std::forward<Args>(args)...);
+  }
+
+  //! Método adiciona no início da lista
+  /*!
+     Adiciona elemento (data) no início da lista, deslocando os elementos do
+     primeiro bloco.
+
+     \param data: Referência constante para o elemento a ser adicionado na lista
+     (const T&).
+   */
+  void push_front(const T& data);
+
+  //! Método adiciona no início da lista (movimento)
+  /*!
+     Como push_front(const T&), mas move data para a lista em vez de copiá-lo.
+
+     \param data: Elemento a ser movido para a lista (T&&).
+   */
+  void push_front(T&& data);
+
+  //! Método constrói no início da lista
+  /*!
+     Como emplace_back, mas adiciona o elemento no início da lista.
+
+     \param args: Argumentos repassados ao construtor de T.
+     \return Referência ao elemento adicionado (T&).
+   */
+  template <typename... Args>
+  T& emplace_front(Args&&... args) {
+    return emplace(0u, std::forward<Args>(args)...);
+  }
+
+  //! Método insere na posição
+  /*!
+     Insere elemento (data) em uma dada posição da lista (index), se a posição
+     passada for uma posição válida. Caso a posição não seja válida, lança
+     exceção (out_of_range). Percorre um passo por bloco até a posição e
+     desloca os elementos seguintes do bloco.
+
+     \param data: Referência constante para o elemento a ser inserido (const
+     T&).
+     \param index: Posição para inserir o elemento (size_t).
+   */
+  void insert(const T& data, std::size_t index);
+
+  //! Método insere na posição (movimento)
+  /*!
+     Como insert(const T&, size_t), mas move data para a lista em vez de
+     copiá-lo.
+
+     \param data: Elemento a ser movido para a lista (T&&).
+     \param index: Posição para inserir o elemento (size_t).
+   */
+  void insert(T&& data, std::size_t index);
+
+  //! Método constrói na posição
+  /*!
+     Como emplace_back, mas insere o elemento na posição index. Se a posição
+     não for válida, lança exceção (out_of_range) sem construir o elemento.
+     O elemento é construído antes de a lista ser alterada, então args pode
+     referenciar um elemento da própria lista, e depois é movido para o seu
+     lugar. Se o movimento lançar exceção, o bloco criado para o elemento, se
+     houver, é retirado da lista.
+
+     \param index: Posição para inserir o elemento (size_t).
+     \param args: Argumentos repassados ao construtor de T.
+     \return Referência ao elemento inserido (T&).
+   */
+  template <typename... Args>
+  T& emplace(std::size_t index, Args&&... args) {
+    if (index > size_) {
+      throw std::out_of_range("Invalid index");
+    }
+    // Constrói antes de reservar: args pode referenciar um elemento que a
+    // divisão de um bloco cheio move e destrói.
+    T value(std::forward<Args>(args)...);
+    Block* block = reserve(index);
+    try {
+      T& data = block->emplace(index, std::move(value));
+      size_++;
+      return data;
+    } catch (...) {
+      // Só um bloco novo fica vazio: os demais têm ao menos um elemento.
+      if (block->count() == 0) {
+        unlink(block);
+      }
+      throw;
+    }
+  }
+
+  //! Método insere ordenado
+  /*!
+     Insere elemento (data) em ordem na lista (caso a lista possua ordem).
+
+     \param data: Referência constante para o elemento a ser inserido (const
+     T&).
+   */
+  void insert_sorted(const T& data);
+
+  //! Método remove do final
+  /*!
+     Remove elemento no final da lista, se houver elementos. Se não houver
+     elementos, lança exceção (out_of_range). Custa tempo constante.
+
+     \return Elemento removido, movido para fora do bloco (T).
+   */
+  T pop_back(void);
+
+  //! Método remove do início
+  /*!
+     Remove elemento no início da lista, se houver elementos, deslocando os
+     elementos restantes do primeiro bloco. Se não houver elementos, lança
+     exceção (out_of_range).
+
+     \return Elemento removido, movido para fora do bloco (T).
+   */
+  T pop_front(void);
+
+  //! Método remove da posição
+  /*!
+     Remove elemento na posição passada (index), se houver elementos e se a
+     posição for válida. Se não há elementos ou a posição não é válida, lança
+     exceção (out_of_range).
+
+     \param index: Posição do elemento a ser removido (size_t).
+     \return Elemento removido, movido para fora do bloco (T).
+   */
+  T pop(std::size_t index);
+
+  //! Método remove específico
+  /*!
+     Remove elemento (data) se este estiver presente na lista. Se não houver
+     elementos na lista, ou se data não estiver presente, lança exceção
+     (out_of_range). Quando o elemento está presente, invoca o método pop com
+     a posição de data como parâmetro.
+
+     \param data: Referência constante a elemento a ser removido (const T&).
+   */
+  void remove(const T& data);
+
+  //! Método vazio
+  /*!
+     Verifica se a lista está vazia. Retorna verdadeiro se estiver vazia, caso
+     contrário retorna falso.
+
+     \return true: Lista vazia (bool).
+     \return false: Lista contém elementos (bool).
+   */
+  bool empty(void) const;
+
+  //! Método contém
+  /*!
+     Verifica se a lista contém o elemento (data). Retorna verdadeiro se contém,
+     caso contrário retorna falso.
+
+     \return true: Lista contém o elemento (bool).
+     \return false: Lista não contém o elemento (bool).
+   */
+  bool contains(const T& data) const;
+
+  //! Método achar
+  /*!
+     Acha a posição do elemento (data). Retorna o índice do elemento. Se o
+     elemento não estiver presente, retorna o tamanho da lista. Se a lista
+     estiver vazia, lança exceção (out_of_range).
+
+     \param data: Referência constante ao elemento (const T&).
+     \return Posição do elemento, ou tamanho da lista, caso o elemento não está
+     presente (size_t).
+   */
+  std::size_t find(const T& data) const;
+
+  //! Método tamanho
+  /*!
+     Getter do atributo size_, retorna o tamanho atual da lista.
+
+     \return tamanho da lista (size_t)
+   */
+  std::size_t size(void) const;
+
+  //! Método "em"
+  /*!
+     Retorna referência ao elemento na posição (index). Caso o índice seja
+     inválido lança exceção (out_of_range). Percorre um passo por bloco; os
+     elementos do último bloco são acessados em tempo constante.
+
+     \param index: Posição do elemento a ser retornado (size_t).
+     \return Referência ao elemento na posição (T&).
+   */
+  T& at(std::size_t index);
+
+  //! Sobrecarga do operador []
+  /*!
+     Retorna referência ao elemento na posição (index). Caso o índice seja
+     inválido lança exceção (out_of_range).
+
+     \param index: Posição do elemento a ser retornado (size_t).
+     \return Referência ao elemento na posição (T&).
+   */
+  T& operator[](std::size_t index);
+
+  //! Método "em"
+  /*!
+     Retorna referência constante ao elemento na posição (index). Caso o índice
+     seja inválido lança erro (out_of_range).
+
+     \param index: Posição do elemento a ser retornado (size_t).
+     \return Referência constante ao elemento na posição (const T&).
+   */
+  const T& at(std::size_t index) const;
+
+  //! Sobrecarga do operador []
+  /*!
+     Retorna referência constante ao elemento na posição (index). Caso o índice
+     seja inválido lança exceção (out_of_range).
+
+     \param index: Posição do elemento a ser retornado (size_t).
+     \return Referência constante ao elemento na posição (const T&).
+   */
+  const T& operator[](std::size_t index) const;
+
+ private:
+  //! Classe Block
+  /*!
+     Nodo da lista desenrolada. Guarda até BLOCK_CAPACITY elementos contíguos,
+     construídos nas primeiras count posições, e aponta para os blocos vizinhos.
+   */
+  class Block {
+   public:
+    Block(void) = default;
+
+    Block(const Block&) = delete;
+    Block& operator=(const Block&) = delete;
+
+    //! Destrutor
+    /*!
+       Destrói os elementos do bloco.
+     */
+    ~Block(void) {
+      for (std::size_t i = 0; i != count_; i++) {
+        slot(i)->~T();
+      }
+    }
+
+    //! Método posição
+    /*!
+       Endereço da posição index do bloco, construída ou não.
+
+       \param index: Posição no bloco (size_t).
+       \return Ponteiro para a posição (T *).
+     */
+    T* slot(std::size_t index) {
+      return reinterpret_cast<T*>(storage_) + index;
+    }
+
+    const T* slot(std::size_t index) const {
+      return reinterpret_cast<const T*>(storage_) + index;
+    }
+
+    std::size_t count(void) const { return count_; }
+
+    bool full(void) const { return count_ == BLOCK_CAPACITY; }
+
+    Block* previous(void) const { return previous_; }
+
+    void previous(Block* block) { previous_ = block; }
+
+    Block* next(void) const { return next_; }
+
+    void next(Block* block) { next_ = block; }
+
+    //! Método constrói na posição
+    /*!
+       Constrói um elemento na posição index, que deve estar em [0, count],
+       deslocando os seguintes uma posição. O bloco não pode estar cheio.
+
+       \param index: Posição do novo elemento (size_t).
+       \param args: Argumentos repassados ao construtor de T.
+       \return Referência ao elemento construído (T&).
+     */
+    template <typename... Args>
+    T& emplace(std::size_t index, Args&&... args) {
+      if (index == count_) {
+        new (slot(count_)) T(std::forward<Args>(args)...);
+      } else {
+        T data(std::forward<Args>(args)...);
+        new (slot(count_)) T(std::move(*slot(count_ - 1)));
+        std::move_backward(slot(index), slot(count_ - 1), slot(count_));
+        *slot(index) = std::move(data);
+      }
+      count_++;
+      return *slot(index);
+    }
+
+    //! Método retira
+    /*!
+       Move para fora o elemento na posição index e desloca os seguintes uma
+       posição para trás.
+
+       \param index: Posição do elemento, em [0, count) (size_t).
+       \return Elemento retirado (T).
+     */
+    T take(std::size_t index) {
+      T data = std::move(*slot(index));
+      std::move(slot(index + 1), slot(count_), slot(index));
+      slot(--count_)->~T();
+      return data;
+    }
+
+    //! Método transfere
+    /*!
+       Move os elementos das posições [index, count) para o fim de block, que
+       deve ter espaço para eles.
+
+       \param index: Primeira posição transferida (size_t).
+       \param block: Bloco de destino (Block *).
+     */
+    void move_to(std::size_t index, Block* block) {
+      for (std::size_t i = index; i != count_; i++) {
+        new (block->slot(block->count_)) T(std::move(*slot(i)));
+        block->count_++;
+        slot(i)->~T();
+      }
+      count_ = index;
+    }
+
+   private:
+    Block* previous_{nullptr};
+    Block* next_{nullptr};
+    std::size_t count_{0u};
+    alignas(T) unsigned char storage_[BLOCK_CAPACITY * sizeof(T)];
+  };
+
+  //! Método localiza
+  /*!
+     Acha o bloco que contém a posição index e converte index na posição
+     dentro desse bloco. Posições do último bloco são achadas sem percorrer a
+     lista; index igual ao tamanho resulta na posição seguinte ao fim do
+     último bloco. A lista não pode estar vazia.
+
+     \param index: Posição na lista, em [0, size]; recebe a posição no bloco
+     (size_t&).
+     \return Bloco que contém a posição (Block *).
+   */
+  Block* locate(std::size_t& index) const;
+
+  //! Método reserva
+  /*!
+     Acha o bloco em que um elemento deve ser inserido na posição index, em
+     [0, size], e garante que ele tenha espaço: um bloco cheio é dividido ao
+     meio, ou, nas pontas da lista, ganha um bloco vizinho vazio. Converte
+     index na posição dentro do bloco retornado.
+
+     \param index: Posição na lista; recebe a posição no bloco (size_t&).
+     \return Bloco com espaço para o elemento (Block *).
+   */
+  Block* reserve(std::size_t& index);
+
+  //! Método encadeia bloco
+  /*!
+     Encadeia um bloco novo logo após before, ou no início da lista se before
+     for nulo.
+
+     \param block: Bloco a ser encadeado (Block *).
+     \param before: Bloco que o antecede, ou nullptr (Block *).
+   */
+  void link(Block* block, Block* before);
+
+  //! Método desencadeia bloco
+  /*!
+     Retira block da lista e o libera. Os elementos restantes são destruídos.
+
+     \param block: Bloco a ser liberado (Block *).
+   */
+  void unlink(Block* block);
+
+  //! Método compacta
+  /*!
+     Após uma remoção em block: libera o bloco se ele ficou vazio, ou o funde
+     com o seguinte se ficou com menos da metade da capacidade e os dois cabem
+     em um só bloco.
+
+     \param block: Bloco de onde um elemento foi removido (Block *).
+   */
+  void shrink(Block* block);
+
+  //! Primeiro bloco, ou nullptr se a lista estiver vazia
+  Block* head_{nullptr};
+
+  //! Último bloco, ou nullptr se a lista estiver vazia
+  Block* tail_{nullptr};
+
+  //! Quantidade de elementos
+  std::size_t size_{0u};
+};
+
+}  // namespace structures
+
+#endif
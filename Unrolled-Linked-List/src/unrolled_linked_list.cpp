@@ -0,0 +1,296 @@
+#include "unrolled_linked_list.h"
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+template <typename T>
+structures::UnrolledLinkedList<T>::UnrolledLinkedList(
+    UnrolledLinkedList&& other)
+    : head_{other.head_}, tail_{other.tail_}, size_{other.size_} {
+  other.head_ = nullptr;
+  other.tail_ = nullptr;
+  other.size_ = 0u;
+}
+
+template <typename T>
+structures::UnrolledLinkedList<T>::~UnrolledLinkedList(void) {
+  clear();
+}
+
+template <typename T>
+structures::UnrolledLinkedList<T>& structures::UnrolledLinkedList<T>::operator=(
+    UnrolledLinkedList&& other) {
+  if (this != &other) {
+    clear();
+    head_ = other.head_;
+    tail_ = other.tail_;
+    size_ = other.size_;
+    other.head_ = nullptr;
+    other.tail_ = nullptr;
+    other.size_ = 0u;
+  }
+  return *this;
+}
+
+template <typename T>
+void structures::UnrolledLinkedList<T>::clear(void) {
+  while (head_ != nullptr) {
+    Block* next = head_->next();
+    delete head_;
+    head_ = next;
+  }
+  tail_ = nullptr;
+  size_ = 0u;
+}
+
+template <typename T>
+void structures::UnrolledLinkedList<T>::push_back(const T& data) {
+  emplace_back(data);
+}
+
+template <typename T>
+void structures::UnrolledLinkedList<T>::push_back(T&& data) {
+  emplace_back(std::move(data));
+}
+
+template <typename T>
+void structures::UnrolledLinkedList<T>::push_front(const T& data) {
+  emplace_front(data);
+}
+
+template <typename T>
+void structures::UnrolledLinkedList<T>::push_front(T&& data) {
+  emplace_front(std::move(data));
+}
+
+template <typename T>
+void structures::UnrolledLinkedList<T>::insert(const T& data,
+                                               std::size_t index) {
+  emplace(index, data);
+}
+
+template <typename T>
+void structures::UnrolledLinkedList<T>::insert(T&& data, std::size_t index) {
+  emplace(index, std::move(data));
+}
+
+template <typename T>
+void structures::UnrolledLinkedList<T>::insert_sorted(const T& data) {
+  std::size_t position = 0u;
+  for (Block* block = head_; block != nullptr; block = block->next()) {
+    for (std::size_t i = 0; i != block->count(); i++) {
+      if (!(data > *block->slot(i))) {
+        insert(data, position);
+        return;
+      }
+      position++;
+    }
+  }
+  push_back(data);
+}
+
+template <typename T>
+T structures::UnrolledLinkedList<T>::pop_back(void) {
+  return pop(size_ - 1u);
+}
+
+template <typename T>
+T structures::UnrolledLinkedList<T>::pop_front(void) {
+  if (empty()) {
+    throw std::out_of_range("Cannot pop_front from empty list");
+  }
+  return pop(0u);
+}
+
+template <typename T>
+T structures::UnrolledLinkedList<T>::pop(std::size_t index) {
+  if (empty()) {
+    throw std::out_of_range("Empty list");
+  }
+  if (index >= size()) {
+    throw std::out_of_range("Invalid index!");
+  }
+
+  Block* block = locate(index);
+  T data = block->take(index);
+  size_--;
+  shrink(block);
+
+  return data;
+}
+
+template <typename T>
+void structures::UnrolledLinkedList<T>::remove(const T& data) {
+  pop(find(data));
+}
+
+template <typename T>
+bool structures::UnrolledLinkedList<T>::empty(void) const {
+  return size_ == 0u;
+}
+
+template <typename T>
+bool structures::UnrolledLinkedList<T>::contains(const T& data) const {
+  return find(data) != size();
+}
+
+template <typename T>
+std::size_t structures::UnrolledLinkedList<T>::find(const T& data) const {
+  if (empty()) {
+    throw std::out_of_range("Empty List");
+  }
+
+  std::size_t index = 0u;
+  for (const Block* block = head_; block != nullptr; block = block->next()) {
+    const T* elements = block->slot(0);
+    for (std::size_t i = 0; i != block->count(); i++) {
+      if (elements[i] == data) {
+        return index + i;
+      }
+    }
+    index += block->count();
+  }
+  return index;
+}
+
+template <typename T>
+std::size_t structures::UnrolledLinkedList<T>::size(void) const {
+  return size_;
+}
+
+template <typename T>
+T& structures::UnrolledLinkedList<T>::at(std::size_t index) {
+  return const_cast<T&>(
+      static_cast<const UnrolledLinkedList*>(this)->at(index));
+}
+
+template <typename T>
+const T& structures::UnrolledLinkedList<T>::at(std::size_t index) const {
+  if (empty()) {
+    throw std::out_of_range("List is empty");
+  } else if (index >= size_) {
+    throw std::out_of_range("Index out of bounds");
+  }
+
+  const Block* block = locate(index);
+  return *block->slot(index);
+}
+
+template <typename T>
+T& structures::UnrolledLinkedList<T>::operator[](std::size_t index) {
+  return at(index);
+}
+
+template <typename T>
+const T& structures::UnrolledLinkedList<T>::operator[](
+    std::size_t index) const {
+  return at(index);
+}
+
+template <typename T>
+typename structures::UnrolledLinkedList<T>::Block*
+structures::UnrolledLinkedList<T>::locate(std::size_t& index) const {
+  std::size_t tail_start = size_ - tail_->count();
+  if (index >= tail_start) {
+    index -= tail_start;
+    return tail_;
+  }
+
+  Block* block = head_;
+  while (index >= block->count()) {
+    index -= block->count();
+    block = block->next();
+  }
+  return block;
+}
+
+template <typename T>
+typename structures::UnrolledLinkedList<T>::Block*
+structures::UnrolledLinkedList<T>::reserve(std::size_t& index) {
+  if (tail_ == nullptr) {
+    link(new Block, nullptr);
+    return head_;
+  }
+
+  Block* block = locate(index);
+  if (!block->full()) {
+    return block;
+  }
+
+  Block* previous = block->previous();
+  if (index == 0 && (previous == nullptr || !previous->full())) {
+    // Entre dois blocos: usa o fim do anterior, ou um novo primeiro bloco.
+    if (previous == nullptr) {
+      link(new Block, nullptr);
+      return head_;
+    }
+    index = previous->count();
+    return previous;
+  }
+
+  Block* next = new Block;
+  link(next, block);
+  if (index == block->count()) {
+    index = 0u;
+    return next;
+  }
+  block->move_to(BLOCK_CAPACITY / 2, next);
+  if (index > block->count()) {
+    index -= block->count();
+    return next;
+  }
+  return block;
+}
+
+template <typename T>
+void structures::UnrolledLinkedList<T>::link(Block* block, Block* before) {
+  Block* after = before == nullptr ? head_ : before->next();
+  block->previous(before);
+  block->next(after);
+  if (before == nullptr) {
+    head_ = block;
+  } else {
+    before->next(block);
+  }
+  if (after == nullptr) {
+    tail_ = block;
+  } else {
+    after->previous(block);
+  }
+}
+
+template <typename T>
+void structures::UnrolledLinkedList<T>::unlink(Block* block) {
+  Block* before = block->previous();
+  Block* after = block->next();
+  if (before == nullptr) {
+    head_ = after;
+  } else {
+    before->next(after);
+  }
+  if (after == nullptr) {
+    tail_ = before;
+  } else {
+    after->previous(before);
+  }
+  delete block;
+}
+
+template <typename T>
+void structures::UnrolledLinkedList<T>::shrink(Block* block) {
+  if (block->count() == 0) {
+    unlink(block);
+    return;
+  }
+
+  Block* next = block->next();
+  if (block->count() < BLOCK_CAPACITY / 2 && next != nullptr &&
+      block->count() + next->count() <= BLOCK_CAPACITY) {
+    next->move_to(0u, block);
+    unlink(next);
+  }
+}
+
+template class structures::UnrolledLinkedList<int>;
+template class structures::UnrolledLinkedList<std::string>;
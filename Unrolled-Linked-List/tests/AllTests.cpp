@@ -0,0 +1,274 @@
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "unrolled_linked_list.h"
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+class UnrolledLinkedListTest : public ::testing::Test {
+ protected:
+  //! Elementos suficientes para ocupar vários blocos
+  static constexpr int MANY =
+      4 * structures::UnrolledLinkedList<int>::BLOCK_CAPACITY + 3;
+
+  structures::UnrolledLinkedList<int> list{};
+};
+
+TEST_F(UnrolledLinkedListTest, OnInitSizeIsZero) {
+  ASSERT_EQ(list.size(), 0u);
+  ASSERT_TRUE(list.empty());
+}
+
+TEST_F(UnrolledLinkedListTest, ClearDeletesAllBlocks) {
+  for (auto i = 0; i < MANY; i++) {
+    list.push_front(i);
+  }
+  ASSERT_EQ(list.size(), MANY);
+
+  list.clear();
+  ASSERT_TRUE(list.empty());
+  list.push_back(1);
+  ASSERT_EQ(list.at(0), 1);
+}
+
+TEST_F(UnrolledLinkedListTest, AtThrowsErrorWhenEmptyOrOutOfBounds) {
+  ASSERT_THROW(list.at(0), std::out_of_range);
+  list.push_front(0);
+  ASSERT_THROW(list.at(1), std::out_of_range);
+}
+
+TEST_F(UnrolledLinkedListTest, PushFrontAndBackSpanBlocks) {
+  for (auto i = 0; i < MANY; i++) {
+    list.push_back(i);
+    list.push_front(-i - 1);
+  }
+
+  ASSERT_EQ(list.size(), 2u * MANY);
+  for (auto i = 0; i < 2 * MANY; i++) {
+    ASSERT_EQ(list.at(i), i - MANY);
+  }
+}
+
+TEST_F(UnrolledLinkedListTest, InsertThrowsErrorWhenOutOfBounds) {
+  ASSERT_THROW(list.insert(0, 1), std::out_of_range);
+  list.insert(0, 0);
+  ASSERT_THROW(list.insert(0, 2), std::out_of_range);
+}
+
+TEST_F(UnrolledLinkedListTest, InsertInMiddleSplitsFullBlocks) {
+  for (auto i = 0; i < MANY; i += 2) {
+    list.push_back(i);
+  }
+  for (auto i = 1; i < MANY; i += 2) {
+    list.insert(i, i);
+  }
+
+  ASSERT_EQ(list.size(), MANY);
+  for (auto i = 0; i < MANY; i++) {
+    ASSERT_EQ(list[i], i);
+  }
+}
+
+TEST_F(UnrolledLinkedListTest, InsertingOwnElementSurvivesSplit) {
+  structures::UnrolledLinkedList<std::string> strings{};
+  const auto capacity =
+      structures::UnrolledLinkedList<std::string>::BLOCK_CAPACITY;
+  for (std::size_t i = 0; i < capacity; i++) {
+    strings.push_back(std::string(40, static_cast<char>('a' + i % 26)));
+  }
+  const std::string last = strings[capacity - 1];
+  strings.insert(strings[capacity - 1], 3);
+  strings.emplace(1, strings[capacity]);
+
+  ASSERT_EQ(strings.size(), capacity + 2);
+  ASSERT_EQ(strings[1], last);
+  ASSERT_EQ(strings[4], last);
+  ASSERT_EQ(strings[capacity + 1], last);
+}
+
+TEST_F(UnrolledLinkedListTest, InsertSortedInsertsAtTheCorrectPlace) {
+  list.push_back(0);
+  list.push_back(2);
+  list.push_back(4);
+
+  list.insert_sorted(-1);
+  ASSERT_EQ(list.at(0), -1);
+  list.insert_sorted(1);
+  ASSERT_EQ(list.at(2), 1);
+  list.insert_sorted(5);
+  ASSERT_EQ(list.at(5), 5);
+}
+
+TEST_F(UnrolledLinkedListTest, InsertSortedKeepsOrderAcrossBlocks) {
+  std::mt19937 generator{42};
+  for (auto i = 0; i < MANY; i++) {
+    list.insert_sorted(static_cast<int>(generator() % 1000));
+  }
+
+  for (auto i = 1; i < MANY; i++) {
+    ASSERT_LE(list.at(i - 1), list.at(i));
+  }
+}
+
+TEST_F(UnrolledLinkedListTest, PopThrowsErrorWhenEmptyOrOutOfBounds) {
+  ASSERT_THROW(list.pop(0), std::out_of_range);
+  ASSERT_THROW(list.pop_back(), std::out_of_range);
+  ASSERT_THROW(list.pop_front(), std::out_of_range);
+  list.push_back(0);
+  ASSERT_THROW(list.pop(1), std::out_of_range);
+}
+
+TEST_F(UnrolledLinkedListTest, PopFrontAndBackDrainBlocks) {
+  for (auto i = 0; i < MANY; i++) {
+    list.push_back(i);
+  }
+
+  for (auto i = 0; i < MANY / 2; i++) {
+    ASSERT_EQ(list.pop_front(), i);
+    ASSERT_EQ(list.pop_back(), MANY - 1 - i);
+  }
+  ASSERT_EQ(list.size(), 1u);
+  ASSERT_EQ(list.pop_back(), MANY / 2);
+  ASSERT_TRUE(list.empty());
+  list.push_front(1);
+  ASSERT_EQ(list.at(0), 1);
+}
+
+TEST_F(UnrolledLinkedListTest, PopPopsAtIndexAcrossBlocks) {
+  for (auto i = 0; i < MANY; i++) {
+    list.push_back(i);
+  }
+
+  for (auto i = 0; i < MANY / 2; i++) {
+    ASSERT_EQ(list.pop(i + 1), 2 * i + 1);
+  }
+  ASSERT_EQ(list.size(), MANY - MANY / 2);
+  for (auto i = 0; i < MANY - MANY / 2; i++) {
+    ASSERT_EQ(list.at(i), 2 * i);
+  }
+}
+
+TEST_F(UnrolledLinkedListTest, MatchesVectorUnderRandomOperations) {
+  std::vector<int> model;
+  std::mt19937 generator{7};
+  for (auto i = 0; i < 20 * MANY; i++) {
+    std::size_t index = generator() % (model.size() + 1);
+    if (generator() % 3 != 0 || model.empty()) {
+      list.insert(i, index);
+      model.insert(model.begin() + index, i);
+    } else {
+      index = std::min(index, model.size() - 1);
+      ASSERT_EQ(list.pop(index), model[index]);
+      model.erase(model.begin() + index);
+    }
+  }
+
+  ASSERT_EQ(list.size(), model.size());
+  for (std::size_t i = 0; i < model.size(); i++) {
+    ASSERT_EQ(list.at(i), model[i]);
+  }
+}
+
+TEST_F(UnrolledLinkedListTest, FindReturnsElementIndexOrSize) {
+  ASSERT_THROW(list.find(0), std::out_of_range);
+  for (auto i = 0; i < MANY; i++) {
+    list.push_back(i);
+  }
+
+  ASSERT_EQ(list.find(0), 0u);
+  ASSERT_EQ(list.find(MANY / 2), MANY / 2);
+  ASSERT_EQ(list.find(MANY - 1), MANY - 1);
+  ASSERT_EQ(list.find(MANY), MANY);
+  ASSERT_TRUE(list.contains(MANY - 1));
+  ASSERT_FALSE(list.contains(-1));
+}
+
+TEST_F(UnrolledLinkedListTest, RemovePopsData) {
+  ASSERT_THROW(list.remove(0), std::out_of_range);
+  for (auto i = 0; i < 10; i++) {
+    list.push_back(i);
+  }
+
+  ASSERT_THROW(list.remove(10), std::out_of_range);
+  list.remove(0);
+  ASSERT_FALSE(list.contains(0));
+  list.remove(5);
+  ASSERT_FALSE(list.contains(5));
+  ASSERT_EQ(list.size(), 8u);
+}
+
+TEST_F(UnrolledLinkedListTest, AtReturnsModifiableReference) {
+  for (auto i = 0; i < MANY; i++) {
+    list.push_back(i);
+  }
+
+  list.at(MANY / 2) = -1;
+  list[0] = -2;
+  const auto& constant = list;
+  ASSERT_EQ(constant.at(MANY / 2), -1);
+  ASSERT_EQ(constant[0], -2);
+}
+
+TEST_F(UnrolledLinkedListTest, MoveTakesBlocks) {
+  for (auto i = 0; i < MANY; i++) {
+    list.push_back(i);
+  }
+  structures::UnrolledLinkedList<int> moved{std::move(list)};
+  ASSERT_EQ(moved.size(), MANY);
+  ASSERT_EQ(moved.at(MANY - 1), MANY - 1);
+  ASSERT_TRUE(list.empty());
+
+  list.push_back(-1);
+  list = std::move(moved);
+  ASSERT_EQ(list.size(), MANY);
+  ASSERT_EQ(list.at(0), 0);
+  ASSERT_TRUE(moved.empty());
+}
+
+TEST_F(UnrolledLinkedListTest, StringsAreMovedBetweenBlocks) {
+  structures::UnrolledLinkedList<std::string> strings{};
+  const auto count =
+      3 * structures::UnrolledLinkedList<std::string>::BLOCK_CAPACITY;
+  for (std::size_t i = 0; i < count; i++) {
+    strings.emplace_front(64, static_cast<char>('a' + i % 26));
+  }
+  std::string middle(64, 'z');
+  strings.insert(std::move(middle), count / 2);
+
+  ASSERT_EQ(strings.size(), count + 1);
+  ASSERT_EQ(strings.at(count / 2), std::string(64, 'z'));
+  ASSERT_EQ(strings.pop(count / 2), std::string(64, 'z'));
+  for (std::size_t i = 0; i < count; i++) {
+    char expected = static_cast<char>('a' + (count - 1 - i) % 26);
+    ASSERT_EQ(strings.pop_front(), std::string(64, expected));
+  }
+}
+
+TEST_F(UnrolledLinkedListTest, FailedEmplaceLeavesListUnchanged) {
+  structures::UnrolledLinkedList<std::string> strings{};
+  const auto capacity =
+      structures::UnrolledLinkedList<std::string>::BLOCK_CAPACITY;
+  const auto too_long = std::string{}.max_size() + 1;
+  ASSERT_THROW(strings.emplace_back(too_long, 'x'), std::length_error);
+  ASSERT_TRUE(strings.empty());
+  for (std::size_t i = 0; i < capacity; i++) {
+    strings.emplace_back(1, static_cast<char>('a' + i % 26));
+  }
+  ASSERT_THROW(strings.emplace_back(too_long, 'x'), std::length_error);
+  ASSERT_THROW(strings.emplace_front(too_long, 'x'), std::length_error);
+  ASSERT_EQ(strings.size(), capacity);
+  strings.push_back("end");
+  ASSERT_EQ(strings.at(capacity), "end");
+  for (std::size_t i = 0; i < capacity; i++) {
+    ASSERT_EQ(strings.pop_front(), std::string(1, 'a' + i % 26));
+  }
+  ASSERT_EQ(strings.pop_front(), "end");
+  ASSERT_TRUE(strings.empty());
+}